@@ -0,0 +1,280 @@
+//
+// Created by Rene Windegger on 16/10/2026.
+//
+
+#include "benchmark.hpp"
+
+#include <bigint23/bigint.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace {
+    template<std::size_t width>
+    using uint_t = bigint::bigint<bigint::BitWidth{width}, bigint::Signedness::Unsigned>;
+
+    using benchmark::make_value;
+
+    template<std::size_t width>
+    void arithmetic_suite() {
+        auto const prefix = "u" + std::to_string(width) + " ";
+        auto a = make_value<width>(1);
+        auto b = make_value<width>(2);
+        auto const divisor = make_value<width>(3) >> (width / 2);
+
+        benchmark::measure(prefix + "a += b", [&] {
+            a += b;
+            benchmark::do_not_optimize(a);
+        });
+        benchmark::measure(prefix + "a -= b", [&] {
+            a -= b;
+            benchmark::do_not_optimize(a);
+        });
+        benchmark::measure(prefix + "a * b", [&] {
+            auto result = a * b;
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "a / divisor", [&] {
+            auto result = a / divisor;
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "a % divisor", [&] {
+            auto result = a % divisor;
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "a << 13", [&] {
+            auto result = a << 13;
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "a >> 13", [&] {
+            auto result = a >> 13;
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "a < b", [&] {
+            auto result = a < b;
+            benchmark::do_not_optimize(result);
+        });
+    }
+
+    // Operations with a built-in integer on the other side, as in counters and digit extraction.
+    template<std::size_t width>
+    void mixed_suite() {
+        auto const prefix = "u" + std::to_string(width) + " ";
+        auto a = make_value<width>(1);
+        auto const fee = std::uint32_t{1000};
+        auto const limit = std::int64_t{-7};
+
+        benchmark::measure(prefix + "a += 1000", [&] {
+            a += fee;
+            benchmark::do_not_optimize(a);
+        });
+        benchmark::measure(prefix + "a -= 1000", [&] {
+            a -= fee;
+            benchmark::do_not_optimize(a);
+        });
+        benchmark::measure(prefix + "a * 1000", [&] {
+            auto result = a * fee;
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "a / 1000", [&] {
+            auto result = a / fee;
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "a % 1000", [&] {
+            auto result = a % fee;
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "a < -7", [&] {
+            auto result = a < limit;
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "a == 1000", [&] {
+            auto result = a == fee;
+            benchmark::do_not_optimize(result);
+        });
+    }
+
+    // Operands that differ in the top limb, in the bottom limb only, and operands of different widths.
+    template<std::size_t width>
+    void comparison_suite() {
+        using int_t = bigint::bigint<bigint::BitWidth{width}, bigint::Signedness::Signed>;
+        auto const prefix = "u" + std::to_string(width) + " ";
+        auto const a = make_value<width>(1);
+        auto const b = make_value<width>(2);
+        auto const c = a ^ uint_t<width>{1};
+        auto const narrow = uint_t<width / 2>{make_value<width / 2>(3)};
+        auto const negative = -int_t{a >> 1};
+
+        benchmark::measure(prefix + "a < b", [&] {
+            auto result = a < b;
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "a <=> (a ^ 1)", [&] {
+            auto result = a <=> c;
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "a == (a ^ 1)", [&] {
+            auto result = a == c;
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "a <=> u" + std::to_string(width / 2), [&] {
+            auto result = a <=> narrow;
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "-a <=> u" + std::to_string(width / 2), [&] {
+            auto result = negative <=> narrow;
+            benchmark::do_not_optimize(result);
+        });
+    }
+
+    template<std::size_t width>
+    void bit_suite() {
+        auto const prefix = "u" + std::to_string(width) + " ";
+        auto const a = make_value<width>(1);
+        auto const b = a >> (width - 70);
+
+        benchmark::measure(prefix + "all bits with (a >> i) & 1", [&] {
+            auto count = 0;
+            for (auto i = 0uz; i < width; ++i) {
+                count += ((a >> i) & uint_t<width>{1}) != std::uint8_t{0};
+            }
+            benchmark::do_not_optimize(count);
+        });
+        benchmark::measure(prefix + "all bits with a.test_bit(i)", [&] {
+            auto count = 0;
+            for (auto i = 0uz; i < width; ++i) {
+                count += a.test_bit(i);
+            }
+            benchmark::do_not_optimize(count);
+        });
+        benchmark::measure(prefix + "popcount(a)", [&] {
+            auto result = popcount(a);
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "bit_width(a >> (width - 70))", [&] {
+            auto result = bit_width(b);
+            benchmark::do_not_optimize(result);
+        });
+    }
+
+    template<std::size_t width>
+    void shift_suite() {
+        auto const prefix = "u" + std::to_string(width) + " ";
+        auto a = make_value<width>(1);
+        auto const top = ~(~uint_t<width>{} >> 1);
+
+        for (auto const shift: {1uz, 13uz, 64uz, width / 2 + 5}) {
+            benchmark::measure(prefix + "a <<= " + std::to_string(shift), [&] {
+                a <<= shift;
+                a |= 1;
+                benchmark::do_not_optimize(a);
+            });
+            benchmark::measure(prefix + "a >>= " + std::to_string(shift), [&] {
+                a >>= shift;
+                a |= top;
+                benchmark::do_not_optimize(a);
+            });
+        }
+    }
+
+    template<std::size_t width>
+    void root_suite() {
+        auto const prefix = "u" + std::to_string(width) + " ";
+        auto const a = make_value<width>(1);
+
+        benchmark::measure(prefix + "newton sqrt from 2^(bit_width / 2)", [&] {
+            auto root = uint_t<width>{1} << ((bit_width(a) + 1) / 2);
+            while (true) {
+                auto next = (root + a / root) >> 1;
+                if (next >= root) {
+                    break;
+                }
+                root = next;
+            }
+            benchmark::do_not_optimize(root);
+        });
+        benchmark::measure(prefix + "isqrt(a)", [&] {
+            auto result = isqrt(a);
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "iroot(a, 5)", [&] {
+            auto result = iroot(a, 5);
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "ilog10 by repeated * 10", [&] {
+            auto result = 0;
+            for (auto power = uint_t<width>{10}; power <= a; power *= 10) {
+                ++result;
+                if (power > ~uint_t<width>{} / 10) {
+                    break;
+                }
+            }
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "ilog10(a)", [&] {
+            auto result = ilog10(a);
+            benchmark::do_not_optimize(result);
+        });
+    }
+}
+
+BIGINT_BENCHMARK(arithmetic) {
+    arithmetic_suite<128>();
+    arithmetic_suite<256>();
+    arithmetic_suite<512>();
+}
+
+BIGINT_BENCHMARK(comparison) {
+    comparison_suite<256>();
+    comparison_suite<1024>();
+    comparison_suite<4096>();
+}
+
+BIGINT_BENCHMARK(bits) {
+    bit_suite<256>();
+    bit_suite<1024>();
+}
+
+BIGINT_BENCHMARK(shift) {
+    shift_suite<256>();
+    shift_suite<1024>();
+    shift_suite<4096>();
+}
+
+BIGINT_BENCHMARK(roots) {
+    root_suite<256>();
+    root_suite<1024>();
+}
+
+BIGINT_BENCHMARK(mixed_arithmetic) {
+    mixed_suite<128>();
+    mixed_suite<256>();
+    mixed_suite<1024>();
+}
+
+#if defined(__SIZEOF_INT128__)
+BIGINT_BENCHMARK(native_uint128) {
+    __extension__ using uint128_t = unsigned __int128;
+    auto a = (uint128_t{0x9E3779B97F4A7C15ULL} << 64) | 0xBF58476D1CE4E5B9ULL;
+    auto b = (uint128_t{0x94D049BB133111EBULL} << 64) | 0x2545F4914F6CDD1DULL;
+    auto big_a = make_value<128>(1);
+    auto const big_b = make_value<128>(2);
+
+    benchmark::measure("unsigned __int128 a += b", [&] {
+        a += b;
+        benchmark::do_not_optimize(a);
+    });
+    benchmark::measure("u128 a += b", [&] {
+        big_a += big_b;
+        benchmark::do_not_optimize(big_a);
+    });
+    benchmark::measure("unsigned __int128 a -= b", [&] {
+        a -= b;
+        benchmark::do_not_optimize(a);
+    });
+    benchmark::measure("u128 a -= b", [&] {
+        big_a -= big_b;
+        benchmark::do_not_optimize(big_a);
+    });
+}
+#endif
@@ -0,0 +1,92 @@
+//
+// Created by Rene Windegger on 16/10/2026.
+//
+
+#pragma once
+
+#include <bigint23/bigint.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace benchmark {
+    using clock = std::chrono::steady_clock;
+
+    struct entry {
+        std::string name;
+        std::function<void()> body;
+    };
+
+    inline std::vector<entry> &registry() {
+        static std::vector<entry> entries;
+        return entries;
+    }
+
+    struct registrar {
+        registrar(std::string name, std::function<void()> body) {
+            registry().push_back({std::move(name), std::move(body)});
+        }
+    };
+
+    // One step of the 64 bit linear congruential generator (Knuth's MMIX constants) the operands are drawn from.
+    inline std::uint64_t next_random(std::uint64_t &seed) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        return seed;
+    }
+
+    // A full width operand with one generator step per 64 bits, most significant first.
+    template<std::size_t width>
+    bigint::bigint<bigint::BitWidth{width}, bigint::Signedness::Unsigned> make_value(std::uint64_t seed) {
+        auto result = bigint::bigint<bigint::BitWidth{width}, bigint::Signedness::Unsigned>{};
+        for (auto i = std::size_t{0}; i < width / 64; ++i) {
+            result <<= 64;
+            result += next_random(seed);
+        }
+        return result;
+    }
+
+    template<typename T>
+    inline void do_not_optimize(T &value) {
+#if defined(__GNUC__) or defined(__clang__)
+        asm volatile("" : "+m"(value) : : "memory");
+#else
+        static void *volatile sink;
+        sink = static_cast<void *>(std::addressof(value));
+#endif
+    }
+
+    // Runs body in doubling batches until at least min_time has elapsed and reports the time per call.
+    template<typename F>
+    void measure(std::string_view const label, F &&body,
+                 clock::duration const min_time = std::chrono::milliseconds{200}) {
+        auto iterations = std::size_t{1};
+        while (true) {
+            auto const start = clock::now();
+            for (auto i = std::size_t{0}; i < iterations; ++i) {
+                body();
+            }
+            auto const elapsed = clock::now() - start;
+            if (elapsed >= min_time) {
+                auto const ns = std::chrono::duration<double, std::nano>(elapsed).count() /
+                                static_cast<double>(iterations);
+                std::printf("%-48.*s %14.2f ns/op %12zu iterations\n", static_cast<int>(label.size()), label.data(), ns,
+                            iterations);
+                return;
+            }
+            iterations *= 2;
+        }
+    }
+}
+
+#define BIGINT_BENCHMARK(name)                                                      \
+    static void name();                                                             \
+    static benchmark::registrar const name##_registrar{#name, name};                \
+    static void name()
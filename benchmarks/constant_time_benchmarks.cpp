@@ -0,0 +1,107 @@
+//
+// Created by Rene Windegger on 16/10/2026.
+//
+
+#include "benchmark.hpp"
+
+#include <bigint23/bigint.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    using u256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+
+    // Running mean and variance of one class of timings (Welford).
+    struct moments {
+        double count = 0;
+        double mean = 0;
+        double squares = 0;
+
+        void push(double const x) {
+            count += 1;
+            auto const delta = x - mean;
+            mean += delta / count;
+            squares += delta * (x - mean);
+        }
+
+        [[nodiscard]] double variance() const {
+            return squares / (count - 1);
+        }
+    };
+
+    // Welch's t statistic between the two classes.
+    double welch_t(moments const &a, moments const &b) {
+        return (a.mean - b.mean) / std::sqrt(a.variance() / a.count + b.variance() / b.count);
+    }
+
+    // Timing leakage test after dudect (Reparaz, Balasch and Verbauwhede, "Dude, is my code constant time?"): the
+    // operation runs on a fixed input and on random inputs in random order, and Welch's t-test checks whether the
+    // two timing distributions differ. Large outliers from interrupts are cropped at a few percentiles, the highest
+    // |t| is reported. Above 4.5 the classes are distinguishable and the operation leaks; below that no leak was
+    // detected with this many measurements, which is evidence, not proof.
+    template<typename F>
+    void leakage(std::string const &label, u256 const &fixed, F &&operation) {
+        constexpr auto measurements = 100000uz;
+        constexpr auto repetitions = 8;
+        auto random = std::mt19937_64{42};
+        auto classes = std::vector<int>(measurements);
+        auto inputs = std::vector<u256>(measurements);
+        for (auto i = 0uz; i < measurements; ++i) {
+            classes[i] = static_cast<int>(random() & 1);
+            inputs[i] = classes[i] == 0 ? fixed : benchmark::make_value<256>(random());
+        }
+
+        auto timings = std::vector<double>(measurements);
+        for (auto i = 0uz; i < measurements; ++i) {
+            auto const start = benchmark::clock::now();
+            for (auto j = 0; j < repetitions; ++j) {
+                auto result = operation(inputs[i]);
+                benchmark::do_not_optimize(result);
+            }
+            timings[i] = std::chrono::duration<double, std::nano>(benchmark::clock::now() - start).count();
+        }
+
+        auto sorted = timings;
+        std::ranges::sort(sorted);
+        auto highest = 0.0;
+        for (auto const percentile: {1.0, 0.99, 0.9, 0.5}) {
+            auto const cutoff = sorted[static_cast<std::size_t>(percentile * static_cast<double>(measurements - 1))];
+            auto fixed_class = moments{};
+            auto random_class = moments{};
+            for (auto i = 0uz; i < measurements; ++i) {
+                if (timings[i] <= cutoff) {
+                    (classes[i] == 0 ? fixed_class : random_class).push(timings[i]);
+                }
+            }
+            highest = std::max(highest, std::abs(welch_t(fixed_class, random_class)));
+        }
+        std::printf("%-48.*s %14.2f |t| %14s\n", static_cast<int>(label.size()), label.data(), highest,
+                    highest > 4.5 ? "leaks" : "no leak found");
+    }
+}
+
+// The operators against their ct:: counterparts on secret operands, with a fixed input chosen to hit the early exits
+// of the operators.
+BIGINT_BENCHMARK(constant_time) {
+    auto random = std::mt19937_64{7};
+    auto const secret = benchmark::make_value<256>(random());
+    auto const divisor = benchmark::make_value<256>(random()) >> 100;
+
+    leakage("u256 x == secret", secret, [&](u256 const &x) { return x == secret; });
+    leakage("u256 ct::equal(x, secret)", secret, [&](u256 const &x) { return bigint::ct::equal(x, secret); });
+    leakage("u256 x < secret", secret, [&](u256 const &x) { return x < secret; });
+    leakage("u256 ct::less(x, secret)", secret, [&](u256 const &x) { return bigint::ct::less(x, secret); });
+    leakage("u256 x * secret", u256{}, [&](u256 const &x) { return x * secret; });
+    leakage("u256 ct::mul(x, secret)", u256{}, [&](u256 const &x) { return bigint::ct::mul(x, secret); });
+    leakage("u256 x % divisor", u256{1}, [&](u256 const &x) { return x % divisor; });
+    leakage("u256 ct::divmod(x, divisor)", u256{1}, [&](u256 const &x) { return bigint::ct::divmod(x, divisor); });
+    leakage("u256 select(x == secret, x, secret)", secret, [&](u256 const &x) {
+        return bigint::ct::select(bigint::ct::equal(x, secret), x, secret);
+    });
+}
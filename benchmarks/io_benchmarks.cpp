@@ -0,0 +1,85 @@
+//
+// Created by Rene Windegger on 16/10/2026.
+//
+
+#include "benchmark.hpp"
+
+#include <bigint23/bigint.hpp>
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <streambuf>
+#include <string>
+
+namespace {
+    template<std::size_t width>
+    using uint_t = bigint::bigint<bigint::BitWidth{width}, bigint::Signedness::Unsigned>;
+
+    // Discards everything written to it so that only the formatting work is measured.
+    class null_buffer final : public std::streambuf {
+    protected:
+        int_type overflow(int_type const c) override {
+            return traits_type::not_eof(c);
+        }
+
+        std::streamsize xsputn(char const *, std::streamsize const count) override {
+            return count;
+        }
+    };
+
+    using benchmark::make_value;
+
+    template<std::size_t width>
+    void print_suite() {
+        auto const prefix = "u" + std::to_string(width) + " ";
+        auto const value = make_value<width>(1);
+        auto buffer = null_buffer{};
+        auto os = std::ostream{&buffer};
+
+        benchmark::measure(prefix + "os << dec", [&] {
+            os << std::dec << value;
+        });
+        benchmark::measure(prefix + "os << hex", [&] {
+            os << std::hex << value;
+        });
+        benchmark::measure(prefix + "os << oct", [&] {
+            os << std::oct << value;
+        });
+    }
+
+    template<std::size_t width>
+    void parse_suite() {
+        auto const prefix = "u" + std::to_string(width) + " ";
+        auto const value = make_value<width>(2);
+        auto buffer = std::array<char, width + 2>{};
+        auto const decimal = std::string{buffer.data(), to_chars(buffer.data(), buffer.data() + buffer.size(), value).ptr};
+        auto const hex = "0x" + std::string{
+                             buffer.data(), to_chars(buffer.data(), buffer.data() + buffer.size(), value, 16).ptr
+                         };
+
+        benchmark::measure(prefix + "from decimal string", [&] {
+            auto parsed = uint_t<width>{decimal};
+            benchmark::do_not_optimize(parsed);
+        });
+        benchmark::measure(prefix + "from hex string", [&] {
+            auto parsed = uint_t<width>{hex};
+            benchmark::do_not_optimize(parsed);
+        });
+    }
+}
+
+BIGINT_BENCHMARK(print) {
+    print_suite<128>();
+    print_suite<256>();
+    print_suite<1024>();
+    print_suite<4096>();
+    print_suite<16384>();
+}
+
+BIGINT_BENCHMARK(parse) {
+    parse_suite<128>();
+    parse_suite<256>();
+    parse_suite<1024>();
+    parse_suite<4096>();
+}
@@ -0,0 +1,20 @@
+//
+// Created by Rene Windegger on 16/10/2026.
+//
+
+#include "benchmark.hpp"
+
+#include <cstdio>
+#include <string_view>
+
+int main(int argc, char **argv) {
+    auto const filter = std::string_view{argc > 1 ? argv[1] : ""};
+    for (auto const &[name, body]: benchmark::registry()) {
+        if (name.find(filter) == std::string_view::npos) {
+            continue;
+        }
+        std::printf("[%s]\n", name.c_str());
+        body();
+    }
+    return 0;
+}
@@ -0,0 +1,201 @@
+//
+// Created by Rene Windegger on 16/10/2026.
+//
+
+#include "benchmark.hpp"
+
+#include <bigint23/bigint.hpp>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+namespace {
+    template<std::size_t width>
+    using uint_t = bigint::bigint<bigint::BitWidth{width}, bigint::Signedness::Unsigned>;
+
+    using benchmark::make_value;
+
+    template<std::size_t width>
+    void montgomery_suite() {
+        auto const prefix = "u" + std::to_string(width) + " ";
+        auto const m = make_value<width>(3) | 1;
+        auto const wide_m = uint_t<2 * width>{m};
+        auto const a = make_value<width>(1) % m;
+        auto const b = make_value<width>(2) % m;
+        auto const context = bigint::montgomery_context<bigint::BitWidth{width}>{m};
+        auto const x = context.to_montgomery(a);
+        auto const y = context.to_montgomery(b);
+
+        benchmark::measure(prefix + "widening_mul(a, b) % m", [&] {
+            auto result = widening_mul(a, b) % wide_m;
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "montgomery x * y", [&] {
+            auto result = x * y;
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "montgomery square(x)", [&] {
+            auto result = square(x);
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "montgomery x + y", [&] {
+            auto result = x + y;
+            benchmark::do_not_optimize(result);
+        });
+    }
+
+    template<std::size_t width>
+    void powmod_suite() {
+        auto const prefix = "u" + std::to_string(width) + " ";
+        auto const m = make_value<width>(3) | 1;
+        auto const even = m - 1;
+        auto const base = make_value<width>(1) % m;
+        auto const exponent = make_value<width>(2);
+        auto const context = bigint::montgomery_context<bigint::BitWidth{width}>{m};
+        auto const table = bigint::fixed_base_table{context.to_montgomery(base)};
+
+        benchmark::measure(prefix + "square-and-multiply with %", [&] {
+            auto const wide_m = uint_t<2 * width>{m};
+            auto result = uint_t<2 * width>{1};
+            auto power = uint_t<2 * width>{base};
+            for (auto e = exponent; e != 0; e >>= 1) {
+                if ((e & 1) != 0) {
+                    result = result * power % wide_m;
+                }
+                power = power * power % wide_m;
+            }
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "powmod odd modulus", [&] {
+            auto result = powmod(base, exponent, m);
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "powmod even modulus", [&] {
+            auto result = powmod(base, exponent, even);
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "fixed_base_table pow", [&] {
+            auto result = table.pow(exponent);
+            benchmark::do_not_optimize(result);
+        });
+    }
+
+    template<std::size_t width>
+    void barrett_suite(std::string const &name, uint_t<width> const &d) {
+        auto const prefix = "u" + std::to_string(width) + " ";
+        auto const x = make_value<width>(1);
+        auto const divisor = bigint::barrett_divisor<bigint::BitWidth{width}>{d};
+        benchmark::measure(prefix + "x % " + name, [&] {
+            auto result = x % d;
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "barrett remainder(x) " + name, [&] {
+            auto result = divisor.remainder(x);
+            benchmark::do_not_optimize(result);
+        });
+    }
+
+    template<typename field>
+    void field_suite(std::string const &name) {
+        auto const p = field::modulus();
+        auto const wide_p = uint_t<512>{p};
+        auto const a = make_value<256>(1) % p;
+        auto const b = make_value<256>(2) % p;
+        auto const context = bigint::montgomery_context<bigint::BitWidth{256}>{p};
+        auto const mx = context.to_montgomery(a);
+        auto const my = context.to_montgomery(b);
+        auto const x = field{a};
+        auto const y = field{b};
+
+        benchmark::measure(name + " widening_mul(a, b) % p", [&] {
+            auto result = widening_mul(a, b) % wide_p;
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(name + " montgomery x * y", [&] {
+            auto result = mx * my;
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(name + " field x * y", [&] {
+            auto result = x * y;
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(name + " field square(x)", [&] {
+            auto result = square(x);
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(name + " field x + y", [&] {
+            auto result = x + y;
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(name + " field invert(x)", [&] {
+            auto result = invert(x);
+            benchmark::do_not_optimize(result);
+        });
+    }
+
+    template<std::size_t width>
+    void gcd_suite() {
+        auto const prefix = "u" + std::to_string(width) + " ";
+        auto const m = make_value<width>(2) | 1;
+        auto a = make_value<width>(1);
+        while (gcd(a, m) != 1) {
+            ++a;
+        }
+
+        benchmark::measure(prefix + "euclid with %", [&] {
+            auto x = a;
+            auto y = m;
+            while (y != 0) {
+                x = std::exchange(y, x % y);
+            }
+            benchmark::do_not_optimize(x);
+        });
+        benchmark::measure(prefix + "gcd(a, m)", [&] {
+            auto result = gcd(a, m);
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "extended_gcd(a, m)", [&] {
+            auto result = extended_gcd(a, m);
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "mod_inverse(a, m)", [&] {
+            auto result = mod_inverse(a, m);
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "ct::mod_inverse(a, m)", [&] {
+            auto result = bigint::ct::mod_inverse(a, m);
+            benchmark::do_not_optimize(result);
+        });
+    }
+}
+
+BIGINT_BENCHMARK(gcd) {
+    gcd_suite<256>();
+    gcd_suite<1024>();
+    gcd_suite<4096>();
+}
+
+BIGINT_BENCHMARK(prime_field) {
+    field_suite<bigint::curve25519_field>("2^255 - 19");
+    field_suite<bigint::secp256k1_field>("secp256k1");
+    field_suite<bigint::p256_field>("P-256");
+}
+
+BIGINT_BENCHMARK(barrett) {
+    barrett_suite<256>("1000", uint_t<256>{1000});
+    barrett_suite<256>("2^255 - 19", (uint_t<256>{1} << 255) - 19);
+    barrett_suite<256>("128-bit", make_value<256>(5) >> 128);
+    barrett_suite<2048>("1024-bit", make_value<2048>(5) >> 1024);
+    barrett_suite<2048>("2000-bit", make_value<2048>(5) >> 48);
+}
+
+BIGINT_BENCHMARK(powmod) {
+    powmod_suite<256>();
+    powmod_suite<2048>();
+}
+
+BIGINT_BENCHMARK(montgomery) {
+    montgomery_suite<256>();
+    montgomery_suite<2048>();
+}
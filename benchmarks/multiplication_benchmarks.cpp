@@ -0,0 +1,130 @@
+//
+// Created by Rene Windegger on 16/10/2026.
+//
+
+#include "benchmark.hpp"
+
+#include <bigint23/bigint.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace {
+    template<std::size_t width>
+    using uint_t = bigint::bigint<bigint::BitWidth{width}, bigint::Signedness::Unsigned>;
+
+    using benchmark::make_value;
+
+    std::vector<std::uint64_t> make_limbs(std::size_t const n, std::uint64_t seed) {
+        auto result = std::vector<std::uint64_t>(n);
+        for (auto &limb: result) {
+            limb = benchmark::next_random(seed);
+        }
+        return result;
+    }
+
+    // Full n x n limb product with the given thresholds.
+    void measure_full(std::string const &label, std::size_t const n,
+                      bigint::detail::multiply_thresholds const &thresholds) {
+        auto const a = make_limbs(n, 1);
+        auto const b = make_limbs(n, 2);
+        auto result = std::vector<std::uint64_t>(2 * n);
+        auto scratch = std::vector<std::uint64_t>(bigint::detail::multiply_scratch(n, thresholds) + 1);
+        benchmark::measure(label, [&] {
+            bigint::detail::multiply_full(result.data(), a.data(), b.data(), n, scratch.data(), thresholds);
+            benchmark::do_not_optimize(result);
+        });
+    }
+
+    // Low n x n limb product, the operation behind operator*=, with each algorithm operator*= can pick.
+    void measure_low(std::size_t const n) {
+        auto const &thresholds = bigint::detail::default_multiply_thresholds;
+        auto const a = make_limbs(n, 1);
+        auto const b = make_limbs(n, 2);
+        auto result = std::vector<std::uint64_t>(n);
+        auto scratch = std::vector<std::uint64_t>(bigint::detail::multiply_low_scratch(n, thresholds) + 1);
+        auto const prefix = std::to_string(n * 64) + " bits ";
+        benchmark::measure(prefix + "schoolbook", [&] {
+            bigint::detail::multiply_low_basecase(result.data(), a.data(), b.data(), n);
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "toom3", [&] {
+            bigint::detail::multiply_low(result.data(), a.data(), b.data(), n, scratch.data(), thresholds);
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure(prefix + "ntt", [&] {
+            bigint::detail::multiply_ntt(result.data(), a.data(), b.data(), n, n);
+            benchmark::do_not_optimize(result);
+        });
+    }
+
+    template<std::size_t width>
+    void product_suite() {
+        auto const a = make_value<width>(1);
+        auto const b = make_value<width>(2);
+        benchmark::measure("u" + std::to_string(width) + " a * b", [&] {
+            auto result = a * b;
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure("u" + std::to_string(width) + " square(a)", [&] {
+            auto result = square(a);
+            benchmark::do_not_optimize(result);
+        });
+    }
+
+    template<std::size_t width>
+    void widening_suite() {
+        auto const a = make_value<width>(1);
+        auto const b = make_value<width>(2);
+        benchmark::measure("u" + std::to_string(width) + " widening_mul(a, b)", [&] {
+            auto result = widening_mul(a, b);
+            benchmark::do_not_optimize(result);
+        });
+        benchmark::measure("u" + std::to_string(width) + " widened a * b", [&] {
+            auto result = uint_t<2 * width>{a} * uint_t<2 * width>{b};
+            benchmark::do_not_optimize(result);
+        });
+    }
+}
+
+// Compares one level of each algorithm against the one below it, so the crossover points for
+// bigint_KARATSUBA_THRESHOLD and bigint_TOOM3_THRESHOLD can be read off directly: schoolbook against Karatsuba on
+// top of schoolbook, and Karatsuba against Toom-3 on top of the configured Karatsuba.
+BIGINT_BENCHMARK(multiply_crossover) {
+    constexpr auto never = std::numeric_limits<std::size_t>::max();
+    auto const karatsuba = bigint::detail::default_multiply_thresholds.karatsuba;
+    for (auto const n: {8uz, 12uz, 16uz, 24uz, 32uz, 48uz, 64uz, 96uz, 128uz, 192uz, 256uz}) {
+        auto const prefix = std::to_string(n) + " limbs ";
+        measure_full(prefix + "schoolbook", n, {never, never});
+        measure_full(prefix + "karatsuba", n, {n, never});
+        measure_full(prefix + "karatsuba (tuned)", n, {karatsuba, never});
+        measure_full(prefix + "toom3", n, {karatsuba, n});
+    }
+}
+
+// Schoolbook, Toom-3 and the number-theoretic transform on the low half products operator*= computes, the
+// crossover between the last two is bigint_NTT_THRESHOLD.
+BIGINT_BENCHMARK(multiply_ntt) {
+    for (auto const n: {256uz, 1024uz, 2048uz, 4096uz}) {
+        measure_low(n);
+    }
+}
+
+// The full product against widening both operands with the converting constructor and multiplying in the wider type.
+BIGINT_BENCHMARK(widening_multiply) {
+    widening_suite<256>();
+    widening_suite<1024>();
+    widening_suite<4096>();
+}
+
+BIGINT_BENCHMARK(multiply) {
+    product_suite<1024>();
+    product_suite<2048>();
+    product_suite<4096>();
+    product_suite<8192>();
+    product_suite<16384>();
+    product_suite<65536>();
+    product_suite<262144>();
+}
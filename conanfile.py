@@ -13,7 +13,7 @@ class bigint23(ConanFile):
 
     settings = "os", "compiler", "build_type", "arch"
 
-    exports_sources = ( "CMakeLists.txt", "include/*", "tests/*", "cmake/*" )
+    exports_sources = ( "CMakeLists.txt", "include/*", "tests/*", "benchmarks/*", "cmake/*" )
 
     def layout(self):
         cmake_layout(self)
@@ -7,20 +7,56 @@
 #include <algorithm>
 #include <array>
 #include <bit>
+#include <charconv>
 #include <climits>
+#include <cmath>
 #include <compare>
+#include <concepts>
 #include <cstddef>
 #include <cstdint>
 #ifndef bigint_DISABLE_IO
+#if __has_include(<format>)
+#include <format>
+#endif
 #include <iostream>
 #endif
+#include <limits>
 #include <memory>
 #include <ranges>
 #include <regex>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) and not defined(__clang__)
+#include <intrin.h>
+#elif defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_addcll) and __has_builtin(__builtin_subcll)
+#define bigint_HAS_BUILTIN_ADDCLL
+#endif
+#endif
+
+// Operand sizes in limbs from which multiplication switches from schoolbook to Karatsuba and from Karatsuba to
+// Toom-3. Define these before including the header to override the tuned defaults.
+#ifndef bigint_KARATSUBA_THRESHOLD
+#define bigint_KARATSUBA_THRESHOLD 32
+#endif
+
+#ifndef bigint_TOOM3_THRESHOLD
+#define bigint_TOOM3_THRESHOLD 96
+#endif
+
+// Width in limbs from which operator*= multiplies with a number-theoretic transform instead.
+#ifndef bigint_NTT_THRESHOLD
+#define bigint_NTT_THRESHOLD 2048
+#endif
 
 namespace bigint {
 
@@ -31,1136 +67,4663 @@ namespace bigint {
         Unsigned
     };
 
-    template<BitWidth bits, Signedness signedness>
-    class bigint final {
-    private:
-        static_assert(std::to_underlying(bits) % CHAR_BIT == 0, "bits must be a multiple of CHAR_BIT");
-        std::array<std::uint8_t, std::to_underlying(bits) / CHAR_BIT> data_{};
-
-    public:
-        [[nodiscard]] constexpr bigint() = default;
-
-        template<std::integral T>
-        [[nodiscard]] constexpr bigint(T const data) {
-            static_assert(std::to_underlying(bits) / CHAR_BIT >= sizeof(T),
-                          "Can't assign values with a larger bit count than the target type.");
+    template<typename quotient_type, typename remainder_type = quotient_type>
+    struct divmod_result {
+        quotient_type quotient;
+        remainder_type remainder;
+    };
 
-            auto fill = std::uint8_t{0};
-            if constexpr (std::is_signed_v<T>) {
-                fill = (data < 0 ? 0xFF : 0);
-            }
-            data_.fill(fill);
+    template<typename gcd_type, typename coefficient_type>
+    struct extended_gcd_result {
+        gcd_type gcd;
+        coefficient_type x;
+        coefficient_type y;
+    };
 
-            if constexpr (std::endian::native == std::endian::little) {
-                std::copy_n(reinterpret_cast<std::uint8_t const * const>(std::addressof(data)), sizeof(T),
-                            data_.begin());
+    namespace detail {
+        // Widest machine word (up to 64 bits) that evenly divides the bit width.
+        template<std::size_t bits>
+        using limb_for = std::conditional_t<bits % 64 == 0, std::uint64_t,
+            std::conditional_t<bits % 32 == 0, std::uint32_t,
+                std::conditional_t<bits % 16 == 0, std::uint16_t, std::uint8_t> > >;
+
+        template<std::unsigned_integral limb_type>
+        struct wide_product {
+            limb_type low;
+            limb_type high;
+        };
+
+        template<std::unsigned_integral limb_type>
+        [[nodiscard]] constexpr wide_product<limb_type> mul_wide(limb_type const a, limb_type const b) noexcept {
+            constexpr auto limb_bits = std::size_t{sizeof(limb_type) * CHAR_BIT};
+            if constexpr (sizeof(limb_type) < sizeof(std::uint64_t)) {
+                auto const product = std::uint64_t{std::uint64_t{a} * std::uint64_t{b}};
+                return {static_cast<limb_type>(product), static_cast<limb_type>(product >> limb_bits)};
             } else {
-                std::copy_n(reinterpret_cast<std::uint8_t const * const>(std::addressof(data)), sizeof(T),
-                            data_.end() - sizeof(T));
+#if defined(__SIZEOF_INT128__)
+                __extension__ using uint128_t = unsigned __int128;
+                auto const product = static_cast<uint128_t>(a) * b;
+                return {static_cast<limb_type>(product), static_cast<limb_type>(product >> limb_bits)};
+#else
+#if defined(_MSC_VER) and defined(_M_X64)
+                if !consteval {
+                    auto high = std::uint64_t{0};
+                    auto const low = _umul128(a, b, &high);
+                    return {low, high};
+                }
+#endif
+                auto const a_low = std::uint64_t{a & 0xFFFFFFFF};
+                auto const a_high = std::uint64_t{a >> 32};
+                auto const b_low = std::uint64_t{b & 0xFFFFFFFF};
+                auto const b_high = std::uint64_t{b >> 32};
+                auto const low_low = a_low * b_low;
+                auto const high_low = a_high * b_low;
+                auto const low_high = a_low * b_high;
+                auto const high_high = a_high * b_high;
+                auto const middle = (low_low >> 32) + (high_low & 0xFFFFFFFF) + low_high;
+                return {(middle << 32) | (low_low & 0xFFFFFFFF), high_high + (high_low >> 32) + (middle >> 32)};
+#endif
             }
         }
 
-        template<BitWidth other_bits, Signedness other_signedness>
-        [[nodiscard]] constexpr bigint(bigint<other_bits, other_signedness> const &other) {
-            static_assert(bits >= other_bits, "Can't assign values with a larger bit count than the target type.");
-
-            auto fill = std::uint8_t{0};
-            if constexpr (other_signedness == Signedness::Signed) {
-                fill = other < std::int8_t{0} ? 0xFF : 0;
+        // Returns a + b + carry and stores the outgoing carry (0 or 1). At runtime this maps onto adc so that fixed
+        // width loops over limbs become a single carry chain; constant evaluation uses the portable formulation.
+        template<std::unsigned_integral limb_type>
+        [[nodiscard]] constexpr limb_type add_carry(limb_type const a, limb_type const b, limb_type const carry,
+                                                    limb_type &carry_out) noexcept {
+            if !consteval {
+                if constexpr (sizeof(limb_type) == sizeof(unsigned long long)) {
+#if defined(bigint_HAS_BUILTIN_ADDCLL)
+                    auto out = 0ull;
+                    auto const sum = __builtin_addcll(a, b, carry, &out);
+                    carry_out = static_cast<limb_type>(out);
+                    return static_cast<limb_type>(sum);
+#elif defined(__x86_64__) or defined(_M_X64)
+                    auto sum = 0ull;
+                    carry_out = _addcarry_u64(static_cast<unsigned char>(carry), a, b, &sum);
+                    return static_cast<limb_type>(sum);
+#endif
+                }
             }
-            data_.fill(fill);
+            auto const partial = static_cast<limb_type>(a + b);
+            auto const sum = static_cast<limb_type>(partial + carry);
+            carry_out = static_cast<limb_type>((partial < a) | (sum < partial));
+            return sum;
+        }
 
-            if constexpr (std::endian::native == std::endian::little) {
-                for (auto const i: std::views::iota(0uz, other.data_.size())) {
-                    data_[i] = other.data_[i];
+        // Returns a - b - borrow and stores the outgoing borrow (0 or 1), the sbb counterpart of add_carry.
+        template<std::unsigned_integral limb_type>
+        [[nodiscard]] constexpr limb_type sub_borrow(limb_type const a, limb_type const b, limb_type const borrow,
+                                                     limb_type &borrow_out) noexcept {
+            if !consteval {
+                if constexpr (sizeof(limb_type) == sizeof(unsigned long long)) {
+#if defined(bigint_HAS_BUILTIN_ADDCLL)
+                    auto out = 0ull;
+                    auto const diff = __builtin_subcll(a, b, borrow, &out);
+                    borrow_out = static_cast<limb_type>(out);
+                    return static_cast<limb_type>(diff);
+#elif defined(__x86_64__) or defined(_M_X64)
+                    auto diff = 0ull;
+                    borrow_out = _subborrow_u64(static_cast<unsigned char>(borrow), a, b, &diff);
+                    return static_cast<limb_type>(diff);
+#endif
                 }
+            }
+            auto const partial = static_cast<limb_type>(a - b);
+            auto const diff = static_cast<limb_type>(partial - borrow);
+            borrow_out = static_cast<limb_type>((a < b) | (partial < borrow));
+            return diff;
+        }
+
+        // Limb arrays up to this size are fully unrolled so the carry never leaves the flags register.
+        inline constexpr std::size_t unrolled_limbs = 16;
+
+        // lhs += rhs over equally sized limb arrays, returns the carry out of the top limb.
+        template<std::unsigned_integral limb_type, std::size_t size>
+        constexpr limb_type add_limbs(std::array<limb_type, size> &lhs, std::array<limb_type, size> const &rhs) noexcept {
+            auto carry = limb_type{0};
+            if constexpr (size <= unrolled_limbs) {
+                [&]<std::size_t... i>(std::index_sequence<i...>) {
+                    ((lhs[i] = add_carry(lhs[i], rhs[i], carry, carry)), ...);
+                }(std::make_index_sequence<size>{});
             } else {
-                for (auto const i: std::views::reverse(std::views::iota(1uz, other.data_.size() + 1))) {
-                    data_[data_.size() - i - 1] = other.data_[other.data_.size() - i - 1];
+                for (auto const i: std::views::iota(0uz, size)) {
+                    lhs[i] = add_carry(lhs[i], rhs[i], carry, carry);
                 }
             }
+            return carry;
         }
 
-        [[nodiscard]] constexpr bigint(std::string_view const str) {
-            if (str.length() > 2 and str[0] == '0') {
-                switch (str[1]) {
-                    case 'x':
-                        init_from_string_base(str.substr(2), 16);
-                        break;
-                    case 'b':
-                        init_from_string_base(str.substr(2), 2);
-                        break;
-                    default:
-                        init_from_string_base(str.substr(1), 8);
-                        break;
-                }
+        // lhs -= rhs over equally sized limb arrays, returns the borrow out of the top limb.
+        template<std::unsigned_integral limb_type, std::size_t size>
+        constexpr limb_type sub_limbs(std::array<limb_type, size> &lhs, std::array<limb_type, size> const &rhs) noexcept {
+            auto borrow = limb_type{0};
+            if constexpr (size <= unrolled_limbs) {
+                [&]<std::size_t... i>(std::index_sequence<i...>) {
+                    ((lhs[i] = sub_borrow(lhs[i], rhs[i], borrow, borrow)), ...);
+                }(std::make_index_sequence<size>{});
             } else {
-                if (str[0] == '-') {
-                    if constexpr (signedness == Signedness::Unsigned) {
-                        throw std::runtime_error("Cannot initialize an unsigned bigint23 with a negative value.");
-                    } else {
-                        init_from_string_base(str.substr(1), 10);
-                        *this = -*this;
-                    }
-                } else {
-                    init_from_string_base(str, 10);
+                for (auto const i: std::views::iota(0uz, size)) {
+                    lhs[i] = sub_borrow(lhs[i], rhs[i], borrow, borrow);
                 }
             }
+            return borrow;
         }
 
-        template<std::size_t N>
-        [[nodiscard]] constexpr bigint(char const (&data)[N]) : bigint{std::string_view{data, N - 1}} {
+        // Orders two equally sized limb arrays as unsigned values. Like memcmp on big-endian data, the limbs are
+        // compared from the top and only the first differing pair decides.
+        template<std::unsigned_integral limb_type, std::size_t size>
+        [[nodiscard]] constexpr std::strong_ordering compare_limbs(std::array<limb_type, size> const &lhs,
+                                                                   std::array<limb_type, size> const &rhs) noexcept {
+            auto i = size - 1;
+            if constexpr (size > unrolled_limbs) {
+                // Equal runs of high limbs are skipped a block at a time with memcmp, which compares them vectorized.
+                constexpr auto block = std::size_t{8};
+                while (i >= block and lhs[i] == rhs[i] and
+                       std::equal(lhs.begin() + (i + 1 - block), lhs.begin() + (i + 1), rhs.begin() + (i + 1 - block))) {
+                    i -= block;
+                }
+            }
+            while (i > 0 and lhs[i] == rhs[i]) {
+                --i;
+            }
+            return lhs[i] <=> rhs[i];
         }
 
-        [[nodiscard]] constexpr bigint(std::string const &str) : bigint{std::string_view{str}} {
+        // The limbs a 64 bit word occupies in an array of size limbs of limb_type.
+        template<std::unsigned_integral limb_type, std::size_t size>
+        inline constexpr std::size_t word_limbs = std::min(size, sizeof(std::uint64_t) / sizeof(limb_type));
+
+        // limbs += word. Past the limbs of the word only the carry is propagated and the loop ends as soon as it is
+        // absorbed, so adding a small value touches one or two limbs whatever the size of the array.
+        template<std::unsigned_integral limb_type, std::size_t size>
+        constexpr void add_word(std::array<limb_type, size> &limbs, std::uint64_t const word) noexcept {
+            constexpr auto limb_bits = std::size_t{sizeof(limb_type) * CHAR_BIT};
+            auto carry = limb_type{0};
+            for (auto const i: std::views::iota(0uz, word_limbs<limb_type, size>)) {
+                limbs[i] = add_carry(limbs[i], static_cast<limb_type>(word >> (i * limb_bits)), carry, carry);
+            }
+            for (auto i = word_limbs<limb_type, size>; carry != 0 and i < size; ++i) {
+                limbs[i] = static_cast<limb_type>(limbs[i] + 1);
+                carry = static_cast<limb_type>(limbs[i] == 0);
+            }
         }
 
-        template<std::integral T>
-        bigint constexpr &operator=(T const rhs) {
-            this->~bigint();
-            new(this) bigint(rhs);
-            return *this;
+        // limbs -= word, ending the borrow propagation as soon as it is absorbed.
+        template<std::unsigned_integral limb_type, std::size_t size>
+        constexpr void sub_word(std::array<limb_type, size> &limbs, std::uint64_t const word) noexcept {
+            constexpr auto limb_bits = std::size_t{sizeof(limb_type) * CHAR_BIT};
+            auto borrow = limb_type{0};
+            for (auto const i: std::views::iota(0uz, word_limbs<limb_type, size>)) {
+                limbs[i] = sub_borrow(limbs[i], static_cast<limb_type>(word >> (i * limb_bits)), borrow, borrow);
+            }
+            for (auto i = word_limbs<limb_type, size>; borrow != 0 and i < size; ++i) {
+                borrow = static_cast<limb_type>(limbs[i] == 0);
+                limbs[i] = static_cast<limb_type>(limbs[i] - 1);
+            }
         }
 
-        template<BitWidth other_bits, Signedness other_signedness>
-        bigint constexpr &operator=(bigint<other_bits, other_signedness> const &rhs) {
-            if (this != std::addressof(rhs)) {
-                this->~bigint();
-                new(this) bigint(rhs);
+        // limbs = low size limbs of limbs * word. A word that fits one limb is multiplied in place in a single pass,
+        // narrower limbs take one pass per limb of the word.
+        template<std::unsigned_integral limb_type, std::size_t size>
+        constexpr void multiply_word(std::array<limb_type, size> &limbs, std::uint64_t const word) noexcept {
+            constexpr auto limb_bits = std::size_t{sizeof(limb_type) * CHAR_BIT};
+            if constexpr (word_limbs<limb_type, size> == 1) {
+                auto const multiplier = static_cast<limb_type>(word);
+                auto carry = limb_type{0};
+                for (auto &limb: limbs) {
+                    auto const product = mul_wide(limb, multiplier);
+                    auto overflow = limb_type{0};
+                    limb = add_carry(product.low, carry, limb_type{0}, overflow);
+                    carry = static_cast<limb_type>(product.high + overflow);
+                }
+            } else {
+                auto result = std::array<limb_type, size>{};
+                for (auto const j: std::views::iota(0uz, word_limbs<limb_type, size>)) {
+                    auto const multiplier = static_cast<limb_type>(word >> (j * limb_bits));
+                    if (multiplier == 0) {
+                        continue;
+                    }
+                    auto carry = limb_type{0};
+                    for (auto const i: std::views::iota(0uz, size - j)) {
+                        auto const product = mul_wide(limbs[i], multiplier);
+                        auto first = limb_type{0};
+                        auto second = limb_type{0};
+                        auto const low = add_carry(product.low, carry, limb_type{0}, first);
+                        result[i + j] = add_carry(result[i + j], low, limb_type{0}, second);
+                        carry = static_cast<limb_type>(product.high + first + second);
+                    }
+                }
+                limbs = result;
             }
-            return *this;
         }
 
-        bigint constexpr &operator=(std::string_view const str) {
-            this->~bigint();
-            new(this) bigint(str);
-            return *this;
+        template<std::integral T>
+        [[nodiscard]] constexpr bool is_negative_value(T const value) noexcept {
+            if constexpr (std::is_signed_v<T>) {
+                return value < 0;
+            } else {
+                return false;
+            }
         }
 
-        template<std::size_t N>
-        bigint constexpr &operator=(char const (&rhs)[N]) {
-            this->~bigint();
-            new(this) bigint(rhs);
-            return *this;
+        // |value| as an unsigned word, also for the most negative value of a signed type.
+        template<std::integral T>
+        [[nodiscard]] constexpr std::uint64_t word_magnitude(T const value) noexcept {
+            auto const word = static_cast<std::uint64_t>(value);
+            return is_negative_value(value) ? std::uint64_t{0} - word : word;
         }
 
-        bigint constexpr &operator=(std::string const &rhs) {
-            this->~bigint();
-            new(this) bigint(rhs);
-            return *this;
+        // The double precision shifts of shld and shrd for 0 < shift < limb_bits: the limb of high:low shifted left
+        // that ends at the top of high, and the limb shifted right that starts at the bottom of low. Compilers turn
+        // both into a single funnel shift instruction.
+        template<std::unsigned_integral limb_type>
+        [[nodiscard]] constexpr limb_type funnel_shift_left(limb_type const high, limb_type const low,
+                                                            std::size_t const shift) noexcept {
+            constexpr auto limb_bits = std::size_t{sizeof(limb_type) * CHAR_BIT};
+            return static_cast<limb_type>((high << shift) | (low >> (limb_bits - shift)));
         }
 
-        template<std::integral T>
-        [[nodiscard]] constexpr std::strong_ordering operator<=>(T const other) const {
-            static_assert(std::to_underlying(bits) / CHAR_BIT >= sizeof(T),
-                          "Can't compare values with a larger bit count than the target type.");
+        template<std::unsigned_integral limb_type>
+        [[nodiscard]] constexpr limb_type funnel_shift_right(limb_type const high, limb_type const low,
+                                                             std::size_t const shift) noexcept {
+            constexpr auto limb_bits = std::size_t{sizeof(limb_type) * CHAR_BIT};
+            return static_cast<limb_type>((low >> shift) | (high << (limb_bits - shift)));
+        }
 
-            auto fill = std::uint8_t{0};
-            if constexpr (std::is_signed_v<T>) {
-                fill = (other < 0 ? 0xFF : 0);
+        // limbs <<= shift in place for shift < size * limb_bits. The limbs are written from the top down, so each one
+        // is read before it is overwritten. Whole limb shifts are a plain move and shifting by one is the
+        // add-with-carry chain of limbs + limbs.
+        template<std::unsigned_integral limb_type, std::size_t size>
+        constexpr void shift_left_limbs(std::array<limb_type, size> &limbs, std::size_t const shift) noexcept {
+            constexpr auto limb_bits = std::size_t{sizeof(limb_type) * CHAR_BIT};
+            if (shift == 1) {
+                static_cast<void>(add_limbs(limbs, limbs));
+                return;
             }
+            auto const limb_shift = shift / limb_bits;
+            auto const bit_shift = shift % limb_bits;
+            if (bit_shift == 0) {
+                std::copy_backward(limbs.begin(), limbs.end() - limb_shift, limbs.end());
+            } else {
+                for (auto i = size - 1; i > limb_shift; --i) {
+                    limbs[i] = funnel_shift_left(limbs[i - limb_shift], limbs[i - limb_shift - 1], bit_shift);
+                }
+                limbs[limb_shift] = static_cast<limb_type>(limbs[0] << bit_shift);
+            }
+            std::fill_n(limbs.begin(), limb_shift, limb_type{0});
+        }
 
-            std::array<std::uint8_t, std::to_underlying(bits) / CHAR_BIT> extended{};
-            extended.fill(fill);
-
-            if constexpr (std::endian::native == std::endian::little) {
-                std::copy_n(reinterpret_cast<std::uint8_t const * const>(&other), sizeof(T), extended.begin());
-                for (auto const i: std::views::reverse(std::views::iota(1uz, extended.size() + 1))) {
-                    if constexpr (std::is_signed_v<T>) {
-                        if (static_cast<std::int8_t>(data_[i - 1]) < static_cast<std::int8_t>(extended[i - 1])) {
-                            return std::strong_ordering::less;
-                        }
-                        if (static_cast<std::int8_t>(data_[i - 1]) > static_cast<std::int8_t>(extended[i - 1])) {
-                            return std::strong_ordering::greater;
-                        }
-                    } else {
-                        if (data_[i - 1] < extended[i - 1]) {
-                            return std::strong_ordering::less;
-                        }
-                        if (data_[i - 1] > extended[i - 1]) {
-                            return std::strong_ordering::greater;
-                        }
-                    }
+        // limbs >>= shift in place for shift < size * limb_bits, shifting in copies of fill from the top. Limbs are
+        // written from the bottom up and the loop bounds stay fixed, so short arrays unroll completely.
+        template<std::unsigned_integral limb_type, std::size_t size>
+        constexpr void shift_right_limbs(std::array<limb_type, size> &limbs, std::size_t const shift,
+                                         limb_type const fill) noexcept {
+            constexpr auto limb_bits = std::size_t{sizeof(limb_type) * CHAR_BIT};
+            auto const limb_shift = shift / limb_bits;
+            auto const bit_shift = shift % limb_bits;
+            if (shift == 1) {
+                for (auto const i: std::views::iota(0uz, size - 1)) {
+                    limbs[i] = funnel_shift_right(limbs[i + 1], limbs[i], 1);
+                }
+                limbs[size - 1] = funnel_shift_right(fill, limbs[size - 1], 1);
+            } else if (bit_shift == 0) {
+                for (auto const i: std::views::iota(0uz, size)) {
+                    limbs[i] = i + limb_shift < size ? limbs[i + limb_shift] : fill;
                 }
             } else {
-                std::copy_n(reinterpret_cast<std::uint8_t const * const>(&other), sizeof(T),
-                            extended.end() - sizeof(T));
-                for (auto const i: std::views::iota(0uz, extended.size())) {
-                    if constexpr (std::is_signed_v<T>) {
-                        if (static_cast<std::int8_t>(data_[i]) < static_cast<std::int8_t>(extended[i])) {
-                            return std::strong_ordering::less;
-                        }
-                        if (static_cast<std::int8_t>(data_[i]) > static_cast<std::int8_t>(extended[i])) {
-                            return std::strong_ordering::greater;
-                        }
-                    } else {
-                        if (data_[i] < extended[i]) {
-                            return std::strong_ordering::less;
-                        }
-                        if (data_[i] > extended[i]) {
-                            return std::strong_ordering::greater;
-                        }
-                    }
+                for (auto const i: std::views::iota(0uz, size)) {
+                    auto const low = i + limb_shift < size ? limbs[i + limb_shift] : fill;
+                    auto const high = i + limb_shift + 1 < size ? limbs[i + limb_shift + 1] : fill;
+                    limbs[i] = funnel_shift_right(high, low, bit_shift);
                 }
             }
+        }
 
-            return std::strong_ordering::equal;
+        // shift modulo width as a left rotation in [0, width).
+        [[nodiscard]] constexpr std::size_t rotate_amount(long long const shift, std::size_t const width) noexcept {
+            auto const modulus = static_cast<long long>(width);
+            return static_cast<std::size_t>((shift % modulus + modulus) % modulus);
         }
 
-        template<std::integral T>
-        [[nodiscard]] constexpr bool operator==(T const other) const {
-            static_assert(std::to_underlying(bits) / CHAR_BIT >= sizeof(T),
-                          "Can't compare values with a larger bit count than the target type.");
-            if constexpr (std::is_signed_v<T> and signedness == Signedness::Unsigned) {
-                if (other < 0) {
-                    return false;
+        // Rotates limbs left by shift < size * limb_bits in place: whole limbs first, then the bits with the top limb
+        // wrapping around into the bottom one.
+        template<std::unsigned_integral limb_type, std::size_t size>
+        constexpr void rotate_left_limbs(std::array<limb_type, size> &limbs, std::size_t const shift) noexcept {
+            constexpr auto limb_bits = std::size_t{sizeof(limb_type) * CHAR_BIT};
+            auto const bit_shift = shift % limb_bits;
+            std::ranges::rotate(limbs, limbs.end() - shift / limb_bits);
+            if (bit_shift != 0) {
+                auto const top = limbs[size - 1];
+                for (auto i = size - 1; i > 0; --i) {
+                    limbs[i] = funnel_shift_left(limbs[i], limbs[i - 1], bit_shift);
                 }
+                limbs[0] = funnel_shift_left(limbs[0], top, bit_shift);
             }
+        }
 
-            auto fill = std::uint8_t{0};
-            if constexpr (std::is_signed_v<T>) {
-                fill = (other < 0 ? 0xFF : 0);
-            }
+        template<std::unsigned_integral limb_type>
+        struct wide_quotient {
+            limb_type quotient;
+            limb_type remainder;
+        };
+
+        // Divides the two limb value high:low by divisor. Requires high < divisor so that the quotient fits a limb.
+        template<std::unsigned_integral limb_type>
+        [[nodiscard]] constexpr wide_quotient<limb_type> div_wide(limb_type const high, limb_type const low,
+                                                                  limb_type const divisor) noexcept {
+            constexpr auto limb_bits = std::size_t{sizeof(limb_type) * CHAR_BIT};
+            if constexpr (sizeof(limb_type) < sizeof(std::uint64_t)) {
+                auto const dividend = std::uint64_t{(std::uint64_t{high} << limb_bits) | low};
+                return {static_cast<limb_type>(dividend / divisor), static_cast<limb_type>(dividend % divisor)};
+            } else {
+                if !consteval {
+#if (defined(__GNUC__) or defined(__clang__)) and defined(__x86_64__)
+                    auto quotient = std::uint64_t{};
+                    auto remainder = std::uint64_t{};
+                    asm("divq %[divisor]"
+                        : "=a"(quotient), "=d"(remainder)
+                        : "0"(std::uint64_t{low}), "1"(std::uint64_t{high}), [divisor] "rm"(std::uint64_t{divisor}));
+                    return {quotient, remainder};
+#elif defined(_MSC_VER) and defined(_M_X64)
+                    auto remainder = std::uint64_t{};
+                    auto const quotient = _udiv128(high, low, divisor, &remainder);
+                    return {quotient, remainder};
+#endif
+                }
+                // Hacker's Delight divlu: two 64/32 steps on the normalized divisor.
+                constexpr auto half_bits = std::size_t{limb_bits / 2};
+                constexpr auto base = std::uint64_t{1} << half_bits;
+                constexpr auto half_mask = base - 1;
+                auto const shift = std::countl_zero(divisor);
+                auto const normalized = std::uint64_t{divisor} << shift;
+                auto const divisor_high = normalized >> half_bits;
+                auto const divisor_low = normalized & half_mask;
+                auto const numerator_high = shift == 0
+                                                ? std::uint64_t{high}
+                                                : (std::uint64_t{high} << shift) | (std::uint64_t{low} >> (limb_bits - shift));
+                auto const numerator_low = std::uint64_t{low} << shift;
+                auto const numerator_1 = numerator_low >> half_bits;
+                auto const numerator_0 = numerator_low & half_mask;
+
+                auto quotient_1 = numerator_high / divisor_high;
+                auto estimate = numerator_high - quotient_1 * divisor_high;
+                while (quotient_1 >= base or quotient_1 * divisor_low > base * estimate + numerator_1) {
+                    --quotient_1;
+                    estimate += divisor_high;
+                    if (estimate >= base) {
+                        break;
+                    }
+                }
 
-            std::array<std::uint8_t, std::to_underlying(bits) / CHAR_BIT> extended{};
-            extended.fill(fill);
+                auto const partial = numerator_high * base + numerator_1 - quotient_1 * normalized;
+                auto quotient_0 = partial / divisor_high;
+                estimate = partial - quotient_0 * divisor_high;
+                while (quotient_0 >= base or quotient_0 * divisor_low > base * estimate + numerator_0) {
+                    --quotient_0;
+                    estimate += divisor_high;
+                    if (estimate >= base) {
+                        break;
+                    }
+                }
 
-            if constexpr (std::endian::native == std::endian::little) {
-                std::copy_n(reinterpret_cast<std::uint8_t const * const>(&other), sizeof(T), extended.begin());
-            } else {
-                std::copy_n(reinterpret_cast<std::uint8_t const * const>(&other), sizeof(T),
-                            extended.begin() + (extended.size() - sizeof(T)));
+                auto const remainder = (partial * base + numerator_0 - quotient_0 * normalized) >> shift;
+                return {static_cast<limb_type>(quotient_1 * base + quotient_0), static_cast<limb_type>(remainder)};
             }
+        }
 
-            return extended == data_;
+        // A single limb divisor prepared for repeated division by multiplication with its reciprocal (Moeller and
+        // Granlund, "Improved division by invariant integers"). normalized is the divisor shifted so that its top bit
+        // is set and reciprocal is floor((b^2 - 1) / normalized) - b for the limb base b.
+        template<std::unsigned_integral limb_type>
+        struct limb_divisor {
+            limb_type divisor;
+            limb_type normalized;
+            limb_type reciprocal;
+            std::size_t shift;
+
+            constexpr explicit limb_divisor(limb_type const value) noexcept
+                : divisor{value},
+                  normalized{static_cast<limb_type>(value << std::countl_zero(value))},
+                  reciprocal{div_wide(static_cast<limb_type>(~normalized), static_cast<limb_type>(~limb_type{0}),
+                                      normalized).quotient},
+                  shift{static_cast<std::size_t>(std::countl_zero(value))} {
+            }
+        };
+
+        // Divides high:low by the normalized divisor using its reciprocal. Requires high < d.normalized.
+        template<std::unsigned_integral limb_type>
+        [[nodiscard]] constexpr wide_quotient<limb_type> div_2by1(limb_type const high, limb_type const low,
+                                                                  limb_divisor<limb_type> const &d) noexcept {
+            auto const product = mul_wide(d.reciprocal, high);
+            auto carry = limb_type{0};
+            auto const quotient_low = add_carry(product.low, low, limb_type{0}, carry);
+            auto quotient = add_carry(product.high, static_cast<limb_type>(high + 1), carry, carry);
+            auto remainder = static_cast<limb_type>(low - static_cast<limb_type>(quotient * d.normalized));
+            if (remainder > quotient_low) {
+                --quotient;
+                remainder = static_cast<limb_type>(remainder + d.normalized);
+            }
+            if (remainder >= d.normalized) {
+                ++quotient;
+                remainder = static_cast<limb_type>(remainder - d.normalized);
+            }
+            return {quotient, remainder};
         }
 
-        template<BitWidth other_bits, Signedness other_signedness>
-        [[nodiscard]] constexpr std::strong_ordering operator
-        <=>(bigint<other_bits, other_signedness> const &other) const {
-            static constexpr std::size_t lhs_size = std::to_underlying(bits) / CHAR_BIT;
-            static constexpr std::size_t rhs_size = std::to_underlying(other_bits) / CHAR_BIT;
-            static constexpr std::size_t max_size = (lhs_size > rhs_size ? lhs_size : rhs_size);
+        // Divides the size limbs at limbs in place by a single limb and returns the remainder. The limbs are passed
+        // by pointer so that one body serves every array size; a body templated on the capacity gets folded across
+        // sizes and then draws false -Warray-bounds reports for the smaller arrays.
+        template<std::unsigned_integral limb_type>
+        constexpr limb_type short_divide(limb_type *const limbs, std::size_t const size,
+                                         limb_divisor<limb_type> const &d) noexcept {
+            constexpr auto limb_bits = std::size_t{sizeof(limb_type) * CHAR_BIT};
+            if (size == 0) {
+                return 0;
+            }
+            auto rest = d.shift == 0 ? limb_type{0} : static_cast<limb_type>(limbs[size - 1] >> (limb_bits - d.shift));
+            for (auto const i: std::views::reverse(std::views::iota(0uz, size))) {
+                auto const lower = (d.shift == 0 or i == 0) ? limb_type{0} : static_cast<limb_type>(limbs[i - 1] >> (limb_bits - d.shift));
+                auto const step = div_2by1(rest, static_cast<limb_type>((limbs[i] << d.shift) | lower), d);
+                limbs[i] = step.quotient;
+                rest = step.remainder;
+            }
+            return static_cast<limb_type>(rest >> d.shift);
+        }
 
-            std::array<std::uint8_t, max_size> lhs_extended{};
-            std::array<std::uint8_t, max_size> rhs_extended{};
+        template<std::unsigned_integral limb_type, std::size_t size>
+        constexpr limb_type short_divide(std::array<limb_type, size> &limbs, limb_type const divisor) noexcept {
+            auto significant = size;
+            while (significant > 0 and limbs[significant - 1] == 0) {
+                --significant;
+            }
+            return short_divide(limbs.data(), significant, limb_divisor<limb_type>{divisor});
+        }
 
-            auto lhs_fill = std::uint8_t{0};
-            if constexpr (signedness == Signedness::Signed) {
-                if constexpr (std::endian::native == std::endian::little) {
-                    if (data_[lhs_size - 1] & 0x80) {
-                        lhs_fill = 0xFF;
-                    }
-                } else {
-                    if (data_[0] & 0x80) {
-                        lhs_fill = 0xFF;
-                    }
+        // Schoolbook division of limb arrays (Knuth, TAOCP vol. 2, 4.3.1, Algorithm D). The divisor is normalized
+        // so its top limb has the high bit set, which keeps every two-by-one quotient estimate at most two too large.
+        template<std::unsigned_integral limb_type, std::size_t size>
+        constexpr void divide_limbs(std::array<limb_type, size> const &dividend,
+                                    std::array<limb_type, size> const &divisor,
+                                    std::array<limb_type, size> &quotient,
+                                    std::array<limb_type, size> &remainder) {
+            constexpr auto limb_bits = std::size_t{sizeof(limb_type) * CHAR_BIT};
+            auto const significant = [](std::array<limb_type, size> const &limbs) {
+                auto count = size;
+                while (count > 0 and limbs[count - 1] == 0) {
+                    --count;
                 }
+                return count;
+            };
+
+            auto const m = significant(dividend);
+            auto const n = significant(divisor);
+            quotient.fill(0);
+            remainder.fill(0);
+            if (n == 0) {
+                throw std::overflow_error("Division by zero");
+            }
+            if (m < n) {
+                remainder = dividend;
+                return;
             }
-            lhs_extended.fill(lhs_fill);
 
-            auto rhs_fill = std::uint8_t{0};
-            if constexpr (other_signedness == Signedness::Signed) {
-                if constexpr (std::endian::native == std::endian::little) {
-                    if (other.data_[rhs_size - 1] & 0x80) {
-                        rhs_fill = 0xFF;
-                    }
-                } else {
-                    if (other.data_[0] & 0x80) {
-                        rhs_fill = 0xFF;
-                    }
-                }
+            if (n == 1) {
+                quotient = dividend;
+                remainder[0] = short_divide(quotient, divisor[0]);
+                return;
             }
-            rhs_extended.fill(rhs_fill);
 
-            if constexpr (std::endian::native == std::endian::little) {
-                std::copy(data_.begin(), data_.end(), lhs_extended.begin());
-                std::copy(other.data_.begin(), other.data_.end(), rhs_extended.begin());
-            } else {
-                std::copy(data_.begin(), data_.end(), lhs_extended.begin() + (max_size - lhs_size));
-                std::copy(other.data_.begin(), other.data_.end(), rhs_extended.begin() + (max_size - rhs_size));
+            auto const shift = static_cast<std::size_t>(std::countl_zero(divisor[n - 1]));
+            auto normalized_divisor = std::array<limb_type, size>{};
+            auto normalized_dividend = std::array<limb_type, size + 1>{};
+            for (auto const i: std::views::iota(0uz, n)) {
+                auto const carry_in = (shift == 0 or i == 0) ? limb_type{0} : static_cast<limb_type>(divisor[i - 1] >> (limb_bits - shift));
+                normalized_divisor[i] = static_cast<limb_type>((divisor[i] << shift) | carry_in);
+            }
+            for (auto const i: std::views::iota(0uz, m + 1)) {
+                auto const current = i < m ? dividend[i] : limb_type{0};
+                auto const carry_in = (shift == 0 or i == 0) ? limb_type{0} : static_cast<limb_type>(dividend[i - 1] >> (limb_bits - shift));
+                normalized_dividend[i] = static_cast<limb_type>((current << shift) | carry_in);
             }
 
-            if constexpr (std::endian::native == std::endian::little) {
-                for (auto const i: std::views::reverse(std::views::iota(0uz, max_size))) {
-                    std::strong_ordering value{std::strong_ordering::equal};
-                    if (spaceship_check_index<max_size, other_signedness>(lhs_extended, rhs_extended, i, value)) {
-                        return value;
-                    }
+            auto const divisor_top = normalized_divisor[n - 1];
+            auto const divisor_next = normalized_divisor[n - 2];
+            for (auto const j: std::views::reverse(std::views::iota(0uz, m - n + 1))) {
+                auto estimate = limb_type{0};
+                auto rest = limb_type{0};
+                auto rest_overflow = false;
+                if (normalized_dividend[j + n] >= divisor_top) {
+                    estimate = static_cast<limb_type>(~limb_type{0});
+                    auto carry = limb_type{0};
+                    rest = add_carry(normalized_dividend[j + n - 1], divisor_top, limb_type{0}, carry);
+                    rest_overflow = carry != 0;
+                } else {
+                    auto const step = div_wide(normalized_dividend[j + n], normalized_dividend[j + n - 1], divisor_top);
+                    estimate = step.quotient;
+                    rest = step.remainder;
                 }
-            } else {
-                for (auto const i: std::views::iota(0u, max_size)) {
-                    std::strong_ordering value{std::strong_ordering::equal};
-                    if (spaceship_check_index<max_size, other_signedness>(lhs_extended, rhs_extended, i, value)) {
-                        return value;
+
+                while (not rest_overflow) {
+                    auto const product = mul_wide(estimate, divisor_next);
+                    if (product.high < rest or (product.high == rest and product.low <= normalized_dividend[j + n - 2])) {
+                        break;
                     }
+                    --estimate;
+                    auto carry = limb_type{0};
+                    rest = add_carry(rest, divisor_top, limb_type{0}, carry);
+                    rest_overflow = carry != 0;
                 }
-            }
 
-            return std::strong_ordering::equal;
-        }
-
-        template<BitWidth other_bits, Signedness other_signedness>
-        [[nodiscard]] constexpr bool operator==(bigint<other_bits, other_signedness> const &other) const {
-            if constexpr (bits < other_bits) {
-                return other == *this;
-            } else {
-                static_assert(bits >= other_bits, "Can't compare values with a larger bit count than the target type.");
-                if constexpr (other_signedness == Signedness::Signed and signedness == Signedness::Unsigned) {
-                    if (other < std::int8_t{0}) {
-                        return false;
-                    }
+                auto multiply_carry = limb_type{0};
+                auto borrow = limb_type{0};
+                for (auto const i: std::views::iota(0uz, n)) {
+                    auto const product = mul_wide(estimate, normalized_divisor[i]);
+                    auto overflow = limb_type{0};
+                    auto const low = add_carry(product.low, multiply_carry, limb_type{0}, overflow);
+                    multiply_carry = static_cast<limb_type>(product.high + overflow);
+                    normalized_dividend[i + j] = sub_borrow(normalized_dividend[i + j], low, borrow, borrow);
                 }
+                normalized_dividend[j + n] = sub_borrow(normalized_dividend[j + n], multiply_carry, borrow, borrow);
 
-                auto fill = std::uint8_t{0};
-                if constexpr (other_signedness == Signedness::Signed) {
-                    fill = other < std::int8_t{0} ? 0xFF : 0;
+                if (borrow != 0) {
+                    --estimate;
+                    auto carry = limb_type{0};
+                    for (auto const i: std::views::iota(0uz, n)) {
+                        normalized_dividend[i + j] = add_carry(normalized_dividend[i + j], normalized_divisor[i], carry, carry);
+                    }
+                    normalized_dividend[j + n] = static_cast<limb_type>(normalized_dividend[j + n] + carry);
                 }
+                quotient[j] = estimate;
+            }
 
-                std::array<std::uint8_t, std::to_underlying(bits) / CHAR_BIT> extended{};
-                extended.fill(fill);
+            for (auto const i: std::views::iota(0uz, n)) {
+                auto const carry_in = (shift == 0) ? limb_type{0} : static_cast<limb_type>(normalized_dividend[i + 1] << (limb_bits - shift));
+                remainder[i] = static_cast<limb_type>((normalized_dividend[i] >> shift) | carry_in);
+            }
+        }
 
-                if constexpr (std::endian::native == std::endian::little) {
-                    std::copy_n(other.data_.begin(), other.data_.size(), extended.begin());
-                } else {
-                    std::copy_n(other.data_.begin(), other.data_.size(),
-                                extended.begin() + (extended.size() - other.data_.size()));
-                }
-                return extended == data_;
+        // r[0, n) = a[0, n) + b[0, n), returns the carry. r may alias a or b.
+        template<std::unsigned_integral limb_type>
+        constexpr limb_type add_n(limb_type *const r, limb_type const *const a, limb_type const *const b,
+                                  std::size_t const n) noexcept {
+            auto carry = limb_type{0};
+            for (auto i = 0uz; i < n; ++i) {
+                r[i] = add_carry(a[i], b[i], carry, carry);
             }
+            return carry;
         }
 
-        template<std::integral T>
-        constexpr bigint &operator+=(T const other) {
-            *this += bigint{other};
-            return *this;
+        // r[0, n) = a[0, n) - b[0, n), returns the borrow. r may alias a or b.
+        template<std::unsigned_integral limb_type>
+        constexpr limb_type sub_n(limb_type *const r, limb_type const *const a, limb_type const *const b,
+                                  std::size_t const n) noexcept {
+            auto borrow = limb_type{0};
+            for (auto i = 0uz; i < n; ++i) {
+                r[i] = sub_borrow(a[i], b[i], borrow, borrow);
+            }
+            return borrow;
         }
 
-        template<std::integral T>
-        [[nodiscard]] constexpr bigint operator+(T const other) const {
-            auto result = bigint{*this};
-            result += other;
-            return result;
+        // r[0, n) += a[0, m) for m <= n, returns the carry out of the top limb.
+        template<std::unsigned_integral limb_type>
+        constexpr limb_type add_into(limb_type *const r, std::size_t const n, limb_type const *const a,
+                                     std::size_t const m) noexcept {
+            auto carry = add_n(r, r, a, m);
+            for (auto i = m; i < n and carry != 0; ++i) {
+                r[i] = add_carry(r[i], limb_type{0}, carry, carry);
+            }
+            return carry;
         }
 
-        template<BitWidth other_bits, Signedness other_signedness>
-        constexpr bigint &operator+=(bigint<other_bits, other_signedness> const &other) {
-            static constexpr std::size_t this_size = std::to_underlying(bits) / CHAR_BIT;
-            static constexpr std::size_t other_size = std::to_underlying(other_bits) / CHAR_BIT;
-            auto carry = std::uint16_t{0};
-
-            auto fill = std::uint8_t{0};
-            if constexpr (other_signedness == Signedness::Signed) {
-                if constexpr (std::endian::native == std::endian::little) {
-                    if (other.data_[other_size - 1] & 0x80) {
-                        fill = 0xFF;
-                    }
-                } else {
-                    if (other.data_[0] & 0x80) {
-                        fill = 0xFF;
-                    }
-                }
+        // r[0, n) -= a[0, m) for m <= n, returns the borrow out of the top limb.
+        template<std::unsigned_integral limb_type>
+        constexpr limb_type sub_into(limb_type *const r, std::size_t const n, limb_type const *const a,
+                                     std::size_t const m) noexcept {
+            auto borrow = sub_n(r, r, a, m);
+            for (auto i = m; i < n and borrow != 0; ++i) {
+                r[i] = sub_borrow(r[i], limb_type{0}, borrow, borrow);
             }
+            return borrow;
+        }
 
-            for (auto const i: std::views::iota(0uz, this_size)) {
-                if constexpr (std::endian::native == std::endian::little) {
-                    auto const other_byte = std::uint16_t{i < other_size ? other.data_[i] : fill};
-                    auto const sum = static_cast<std::uint16_t>(
-                        static_cast<std::uint16_t>(data_[i]) + other_byte + carry);
-                    data_[i] = static_cast<std::uint8_t>(sum & 0xFF);
-                    carry = sum >> 8;
-                } else {
-                    auto const idx = std::size_t{this_size - 1 - i};
-                    auto const other_byte = std::uint16_t{i < other_size ? other.data_[other_size - 1 - i] : fill};
-                    auto const sum = static_cast<std::uint16_t>(
-                        static_cast<std::uint16_t>(data_[idx]) + other_byte + carry);
-                    data_[idx] = static_cast<std::uint8_t>(sum & 0xFF);
-                    carry = sum >> 8;
+        // Compares a[0, an) with b[0, bn), limbs past the end count as zero.
+        template<std::unsigned_integral limb_type>
+        [[nodiscard]] constexpr std::strong_ordering compare_n(limb_type const *const a, std::size_t const an,
+                                                               limb_type const *const b,
+                                                               std::size_t const bn) noexcept {
+            for (auto i = std::max(an, bn); i > 0; --i) {
+                auto const x = i <= an ? a[i - 1] : limb_type{0};
+                auto const y = i <= bn ? b[i - 1] : limb_type{0};
+                if (x != y) {
+                    return x < y ? std::strong_ordering::less : std::strong_ordering::greater;
                 }
             }
-            return *this;
+            return std::strong_ordering::equal;
         }
 
-        template<BitWidth other_bits, Signedness other_signedness>
-        [[nodiscard]] constexpr bigint operator+(bigint<other_bits, other_signedness> const &other) const {
-            auto result = bigint{*this};
-            result += other;
-            return result;
+        struct multiply_thresholds {
+            std::size_t karatsuba;
+            std::size_t toom3;
+        };
+
+        inline constexpr multiply_thresholds default_multiply_thresholds{
+            bigint_KARATSUBA_THRESHOLD, bigint_TOOM3_THRESHOLD
+        };
+
+        enum class multiply_algorithm {
+            schoolbook,
+            karatsuba,
+            toom3,
+        };
+
+        // Toom-3 needs a non-empty top third and Karatsuba two halves, smaller sizes always use schoolbook.
+        [[nodiscard]] constexpr multiply_algorithm select_multiply(std::size_t const n,
+                                                                   multiply_thresholds const &thresholds) noexcept {
+            if (n >= std::max(thresholds.toom3, std::size_t{5})) {
+                return multiply_algorithm::toom3;
+            }
+            if (n >= std::max(thresholds.karatsuba, std::size_t{2})) {
+                return multiply_algorithm::karatsuba;
+            }
+            return multiply_algorithm::schoolbook;
         }
 
-        template<std::integral T>
-        constexpr bigint &operator*=(T const other) {
-            *this *= bigint{other};
-            return *this;
+        // Scratch limbs multiply_full needs for n limb operands.
+        [[nodiscard]] constexpr std::size_t multiply_scratch(std::size_t const n,
+                                                             multiply_thresholds const &thresholds) noexcept {
+            switch (select_multiply(n, thresholds)) {
+                case multiply_algorithm::toom3: {
+                    auto const k = (n + 2) / 3;
+                    return 6 * (k + 1) + 3 * (2 * k + 2) + multiply_scratch(k + 1, thresholds);
+                }
+                case multiply_algorithm::karatsuba: {
+                    auto const h = (n + 1) / 2;
+                    return 6 * h + 1 + multiply_scratch(h, thresholds);
+                }
+                default:
+                    return 0;
+            }
         }
 
-        template<std::integral T>
-        [[nodiscard]] constexpr bigint operator*(T const other) const {
-            auto result = bigint{*this};
-            result *= other;
-            return result;
+        // Scratch limbs multiply_low needs for n limb operands.
+        [[nodiscard]] constexpr std::size_t multiply_low_scratch(std::size_t const n,
+                                                                 multiply_thresholds const &thresholds) noexcept {
+            auto const k = (n + 1) / 2;
+            if (select_multiply(k, thresholds) == multiply_algorithm::schoolbook) {
+                return 0;
+            }
+            return 2 * k + (n - k) + std::max(multiply_scratch(k, thresholds), multiply_low_scratch(n - k, thresholds));
         }
 
-        template<BitWidth other_bits, Signedness other_signedness>
-        constexpr bigint &operator*=(bigint<other_bits, other_signedness> const &other) {
-            auto negative_result = false;
-            auto abs_this = bigint{*this};
-            auto abs_other = bigint{other};
-
-            if constexpr (signedness == Signedness::Signed) {
-                if (*this < std::int8_t{0}) {
-                    negative_result = !negative_result;
-                    abs_this = -abs_this;
+        // r[0, an + bn) = a[0, an) * b[0, bn)
+        template<std::unsigned_integral limb_type>
+        constexpr void multiply_basecase(limb_type *const r, limb_type const *const a, std::size_t const an,
+                                         limb_type const *const b, std::size_t const bn) noexcept {
+            std::fill_n(r, an + bn, limb_type{0});
+            for (auto i = 0uz; i < bn; ++i) {
+                auto carry = limb_type{0};
+                for (auto j = 0uz; j < an; ++j) {
+                    auto const product = mul_wide(a[j], b[i]);
+                    auto overflow = limb_type{0};
+                    auto const low = add_carry(product.low, carry, limb_type{0}, overflow);
+                    auto const high = static_cast<limb_type>(product.high + overflow);
+                    r[i + j] = add_carry(r[i + j], low, limb_type{0}, overflow);
+                    carry = static_cast<limb_type>(high + overflow);
                 }
+                r[i + an] = carry;
             }
-            if constexpr (other_signedness == Signedness::Signed) {
-                if (other < std::int8_t{0}) {
-                    negative_result = !negative_result;
-                    abs_other = -abs_other;
+        }
+
+        // r[0, n) = low n limbs of a[0, n) * b[0, n). Partial products that only reach the discarded half are skipped.
+        template<std::unsigned_integral limb_type>
+        constexpr void multiply_low_basecase(limb_type *const r, limb_type const *const a, limb_type const *const b,
+                                             std::size_t const n) noexcept {
+            std::fill_n(r, n, limb_type{0});
+            for (auto i = 0uz; i < n; ++i) {
+                auto carry = limb_type{0};
+                for (auto j = 0uz; j < n - i; ++j) {
+                    auto const product = mul_wide(a[i], b[j]);
+                    auto overflow = limb_type{0};
+                    auto const low = add_carry(product.low, carry, limb_type{0}, overflow);
+                    auto const high = static_cast<limb_type>(product.high + overflow);
+                    r[i + j] = add_carry(r[i + j], low, limb_type{0}, overflow);
+                    carry = static_cast<limb_type>(high + overflow);
                 }
             }
+        }
 
-            static constexpr auto n = std::size_t{std::to_underlying(bits) / CHAR_BIT};
-            static constexpr auto m = std::size_t{std::to_underlying(other_bits) / CHAR_BIT};
-            auto result = bigint{};
+        // r[0, n) <<= 1, returns the bit shifted out.
+        template<std::unsigned_integral limb_type>
+        constexpr limb_type double_n(limb_type *const r, std::size_t const n) noexcept {
+            constexpr auto limb_bits = std::size_t{sizeof(limb_type) * CHAR_BIT};
+            auto carry = limb_type{0};
+            for (auto i = 0uz; i < n; ++i) {
+                auto const next = static_cast<limb_type>(r[i] >> (limb_bits - 1));
+                r[i] = static_cast<limb_type>((r[i] << 1) | carry);
+                carry = next;
+            }
+            return carry;
+        }
 
-            for (auto const i: std::views::iota(0uz, n)) {
-                if constexpr (std::endian::native == std::endian::little) {
-                    auto carry = std::uint16_t{0};
-                    for (auto const j: std::views::iota(0uz, m)) {
-                        if (i + j >= n) {
-                            break;
-                        }
-                        auto product = std::uint32_t{
-                            static_cast<std::uint32_t>(abs_this.data_[i]) *
-                            static_cast<std::uint32_t>(abs_other.data_[j])
-                        };
-                        product += static_cast<std::uint32_t>(result.data_[i + j]) + carry;
-                        result.data_[i + j] = static_cast<std::uint8_t>(product & 0xFF);
-                        carry = product >> 8;
-                    }
-                    if (i + m < n) {
-                        auto const sum = std::uint32_t{static_cast<std::uint32_t>(result.data_[i + m]) + carry};
-                        result.data_[i + m] = static_cast<std::uint8_t>(sum & 0xFF);
-                    }
-                } else {
-                    auto const idx1 = std::size_t{n - 1 - i};
-                    auto carry = std::uint16_t{0};
-                    for (auto const j: std::views::iota(0uz, m)) {
-                        if (i + j >= n) {
-                            break;
-                        }
-                        auto const idx2 = std::size_t{m - 1 - j};
-                        auto const result_idx = std::size_t{n - 1 - (i + j)};
-                        auto product = std::uint32_t{
-                            static_cast<std::uint32_t>(abs_this.data_[idx1]) *
-                            static_cast<std::uint32_t>(abs_other.data_[idx2])
-                        };
-                        product += static_cast<std::uint32_t>(result.data_[result_idx]) + carry;
-                        result.data_[result_idx] = static_cast<std::uint8_t>(product & 0xFF);
-                        carry = product >> 8;
-                    }
-                    if (i + m < n) {
-                        auto const result_idx = std::size_t{n - 1 - (i + m)};
-                        auto const sum = std::uint32_t{static_cast<std::uint32_t>(result.data_[result_idx]) + carry};
-                        result.data_[result_idx] = static_cast<std::uint8_t>(sum & 0xFF);
-                    }
+        // r[0, n) += a[0, n / 2 + 1)^2 limb by limb, the diagonal of a square. Only the first n limbs are kept.
+        template<std::unsigned_integral limb_type>
+        constexpr void add_diagonal(limb_type *const r, limb_type const *const a, std::size_t const n) noexcept {
+            auto carry = limb_type{0};
+            for (auto i = 0uz; 2 * i < n; ++i) {
+                auto const product = mul_wide(a[i], a[i]);
+                r[2 * i] = add_carry(r[2 * i], product.low, carry, carry);
+                if (2 * i + 1 < n) {
+                    r[2 * i + 1] = add_carry(r[2 * i + 1], product.high, carry, carry);
                 }
             }
-            if constexpr (signedness == Signedness::Signed) {
-                if (negative_result) {
-                    result = -result;
+        }
+
+        // r[0, 2n) = a[0, n)^2. Every cross product a_i a_j with i < j is computed once, the sum is doubled and the
+        // squares of the limbs are added on the diagonal.
+        template<std::unsigned_integral limb_type>
+        constexpr void square_basecase(limb_type *const r, limb_type const *const a, std::size_t const n) noexcept {
+            std::fill_n(r, 2 * n, limb_type{0});
+            for (auto i = 0uz; i + 1 < n; ++i) {
+                auto carry = limb_type{0};
+                for (auto j = i + 1; j < n; ++j) {
+                    auto const product = mul_wide(a[i], a[j]);
+                    auto overflow = limb_type{0};
+                    auto const low = add_carry(product.low, carry, limb_type{0}, overflow);
+                    auto const high = static_cast<limb_type>(product.high + overflow);
+                    r[i + j] = add_carry(r[i + j], low, limb_type{0}, overflow);
+                    carry = static_cast<limb_type>(high + overflow);
                 }
+                r[i + n] = carry;
             }
-            *this = result;
-            return *this;
+            double_n(r, 2 * n);
+            add_diagonal(r, a, 2 * n);
         }
 
-        template<BitWidth other_bits, Signedness other_signedness>
-        [[nodiscard]] constexpr bigint operator*(bigint<other_bits, other_signedness> const &other) const {
-            auto result = bigint{*this};
-            result *= other;
-            return result;
+        // r[0, n) = low n limbs of a[0, n)^2, the truncated counterpart of square_basecase.
+        template<std::unsigned_integral limb_type>
+        constexpr void square_low_basecase(limb_type *const r, limb_type const *const a, std::size_t const n) noexcept {
+            std::fill_n(r, n, limb_type{0});
+            for (auto i = 0uz; 2 * i + 1 < n; ++i) {
+                auto carry = limb_type{0};
+                for (auto j = i + 1; i + j < n; ++j) {
+                    auto const product = mul_wide(a[i], a[j]);
+                    auto overflow = limb_type{0};
+                    auto const low = add_carry(product.low, carry, limb_type{0}, overflow);
+                    auto const high = static_cast<limb_type>(product.high + overflow);
+                    r[i + j] = add_carry(r[i + j], low, limb_type{0}, overflow);
+                    carry = static_cast<limb_type>(high + overflow);
+                }
+            }
+            double_n(r, n);
+            add_diagonal(r, a, n);
         }
 
-        template<std::integral T>
-        constexpr bigint &operator-=(T const other) {
-            *this -= bigint{other};
-            return *this;
+        // Every kernel below treats a == b as a square: the operand is split and evaluated once, so that the
+        // recursive products are squares again and end up in square_basecase.
+        template<std::unsigned_integral limb_type>
+        constexpr void multiply_full(limb_type *r, limb_type const *a, limb_type const *b, std::size_t n,
+                                     limb_type *scratch, multiply_thresholds const &thresholds) noexcept;
+
+        // Karatsuba with the subtractive middle term: for a = a1 B^h + a0 and b = b1 B^h + b0 the middle coefficient
+        // a1 b0 + a0 b1 is a0 b0 + a1 b1 - (a0 - a1)(b0 - b1), so only three half-size products are needed.
+        template<std::unsigned_integral limb_type>
+        constexpr void multiply_karatsuba(limb_type *const r, limb_type const *const a, limb_type const *const b,
+                                          std::size_t const n, limb_type *const scratch,
+                                          multiply_thresholds const &thresholds) noexcept {
+            auto const h = (n + 1) / 2;
+            auto const l = n - h;
+            auto *const da = scratch;
+            auto *const db = da + h;
+            auto *const middle = db + h;
+            auto *const sum = middle + 2 * h;
+            auto *const rest = sum + 2 * h + 1;
+
+            // d = |x0 - x1| over h limbs, returns whether x1 > x0.
+            auto const difference = [h, l](limb_type *const d, limb_type const *const x) {
+                if (compare_n(x + h, l, x, h) > 0) {
+                    // x0 has no limbs above l here, so the subtraction only spans the l limbs of x1.
+                    sub_n(d, x + h, x, l);
+                    std::fill_n(d + l, h - l, limb_type{0});
+                    return true;
+                }
+                std::copy_n(x, h, d);
+                sub_into(d, h, x + h, l);
+                return false;
+            };
+            auto const squaring = a == b;
+            auto const a_negative = difference(da, a);
+            auto const negative = not squaring and a_negative != difference(db, b);
+
+            multiply_full(middle, da, squaring ? da : db, h, rest, thresholds);
+            multiply_full(r, a, b, h, rest, thresholds);
+            multiply_full(r + 2 * h, a + h, b + h, l, rest, thresholds);
+
+            std::copy_n(r, 2 * h, sum);
+            sum[2 * h] = 0;
+            add_into(sum, 2 * h + 1, r + 2 * h, 2 * l);
+            if (negative) {
+                add_into(sum, 2 * h + 1, middle, 2 * h);
+            } else {
+                sub_into(sum, 2 * h + 1, middle, 2 * h);
+            }
+            add_into(r + h, 2 * n - h, sum, std::min(2 * h + 1, 2 * n - h));
         }
 
-        template<std::integral T>
-        [[nodiscard]] constexpr bigint operator-(T const other) const {
-            auto result = bigint{*this};
-            result -= other;
-            return result;
+        // x[0, n) /= 3 for a two's complement value that is known to be a multiple of three (Granlund and Montgomery,
+        // exact division by multiplication with the inverse modulo the limb base).
+        template<std::unsigned_integral limb_type>
+        constexpr void divide_exact_by_3(limb_type *const x, std::size_t const n) noexcept {
+            constexpr auto inverse = static_cast<limb_type>(static_cast<limb_type>(~limb_type{0}) / 3 * 2 + 1);
+            auto borrow = limb_type{0};
+            for (auto i = 0uz; i < n; ++i) {
+                auto underflow = limb_type{0};
+                auto const quotient = static_cast<limb_type>(sub_borrow(x[i], borrow, limb_type{0}, underflow) * inverse);
+                x[i] = quotient;
+                borrow = static_cast<limb_type>(mul_wide(quotient, limb_type{3}).high + underflow);
+            }
         }
 
-        template<BitWidth other_bits, Signedness other_signedness>
-        constexpr bigint &operator-=(bigint<other_bits, other_signedness> const &other) {
-            static constexpr auto this_size = std::size_t{std::to_underlying(bits) / CHAR_BIT};
-            static constexpr auto other_size = std::size_t{std::to_underlying(other_bits) / CHAR_BIT};
-
-            auto fill = std::uint8_t{0};
-            if constexpr (other_signedness == Signedness::Signed and other_size <= this_size) {
-                if constexpr (std::endian::native == std::endian::little) {
-                    if (other.data_[other_size - 1] & 0x80) {
-                        fill = 0xFF;
-                    }
+        // x[0, n) >>= 1 as a two's complement value.
+        template<std::unsigned_integral limb_type>
+        constexpr void halve_signed(limb_type *const x, std::size_t const n) noexcept {
+            constexpr auto limb_bits = std::size_t{sizeof(limb_type) * CHAR_BIT};
+            for (auto i = 0uz; i + 1 < n; ++i) {
+                x[i] = static_cast<limb_type>((x[i] >> 1) | (x[i + 1] << (limb_bits - 1)));
+            }
+            x[n - 1] = static_cast<limb_type>((x[n - 1] >> 1) | (x[n - 1] & (limb_type{1} << (limb_bits - 1))));
+        }
+
+        template<std::unsigned_integral limb_type>
+        constexpr void negate_n(limb_type *const x, std::size_t const n) noexcept {
+            auto carry = limb_type{1};
+            for (auto i = 0uz; i < n; ++i) {
+                x[i] = add_carry(static_cast<limb_type>(~x[i]), limb_type{0}, carry, carry);
+            }
+        }
+
+        // Toom-3 evaluates both operands split in thirds at 0, 1, -1, -2 and infinity, multiplies the five values and
+        // interpolates the product with Bodrato's sequence. Values at negative points are kept as magnitude and
+        // sign; interpolation runs in two's complement over 2k + 2 limbs.
+        template<std::unsigned_integral limb_type>
+        constexpr void multiply_toom3(limb_type *const r, limb_type const *const a, limb_type const *const b,
+                                      std::size_t const n, limb_type *const scratch,
+                                      multiply_thresholds const &thresholds) noexcept {
+            constexpr auto limb_bits = std::size_t{sizeof(limb_type) * CHAR_BIT};
+            auto const k = (n + 2) / 3;
+            auto const s = n - 2 * k;
+            auto const e = k + 1;
+            auto const w = 2 * k + 2;
+            auto *const a1 = scratch;
+            auto *const am1 = a1 + e;
+            auto *const am2 = am1 + e;
+            auto *const b1 = am2 + e;
+            auto *const bm1 = b1 + e;
+            auto *const bm2 = bm1 + e;
+            auto *const r1 = bm2 + e;
+            auto *const rm1 = r1 + w;
+            auto *const rm2 = rm1 + w;
+            auto *const rest = rm2 + w;
+
+            // Fills p1 = x(1), pm1 = |x(-1)| and pm2 = |x(-2)| and returns whether x(-1) and x(-2) are negative.
+            auto const evaluate = [k, s, e](limb_type const *const x, limb_type *const p1, limb_type *const pm1,
+                                            limb_type *const pm2) {
+                auto const *const x1 = x + k;
+                auto const *const x2 = x + 2 * k;
+                std::copy_n(x, k, p1);
+                p1[k] = 0;
+                add_into(p1, e, x2, s);
+
+                auto const m1_negative = compare_n(p1, e, x1, k) < 0;
+                if (m1_negative) {
+                    std::copy_n(x1, k, pm1);
+                    pm1[k] = 0;
+                    sub_into(pm1, e, p1, e);
                 } else {
-                    if (other.data_[0] & 0x80) {
-                        fill = 0xFF;
+                    std::copy_n(p1, e, pm1);
+                    sub_into(pm1, e, x1, k);
+                }
+                add_into(p1, e, x1, k);
+
+                auto m2_negative = m1_negative and compare_n(pm1, e, x2, s) > 0;
+                std::copy_n(pm1, e, pm2);
+                if (not m1_negative) {
+                    add_into(pm2, e, x2, s);
+                } else if (m2_negative) {
+                    sub_into(pm2, e, x2, s);
+                } else {
+                    auto borrow = limb_type{0};
+                    for (auto i = 0uz; i < e; ++i) {
+                        pm2[i] = sub_borrow(i < s ? x2[i] : limb_type{0}, pm2[i], borrow, borrow);
                     }
                 }
-            }
+                for (auto i = e - 1; i > 0; --i) {
+                    pm2[i] = static_cast<limb_type>((pm2[i] << 1) | (pm2[i - 1] >> (limb_bits - 1)));
+                }
+                pm2[0] = static_cast<limb_type>(pm2[0] << 1);
 
-            std::uint16_t borrow = 0;
-            for (auto const i: std::views::iota(0uz, this_size)) {
-                if constexpr (std::endian::native == std::endian::little) {
-                    auto const other_byte = std::uint16_t{i < other_size ? other.data_[i] : fill};
-                    auto diff = static_cast<std::int16_t>(
-                        static_cast<std::int16_t>(data_[i]) - static_cast<std::int16_t>(other_byte) - borrow
-                    );
-                    if (diff < 0) {
-                        diff += 256;
-                        borrow = 1;
-                    } else {
-                        borrow = 0;
-                    }
-                    data_[i] = static_cast<std::uint8_t>(diff);
+                if (m2_negative) {
+                    add_into(pm2, e, x, k);
+                } else if (compare_n(pm2, e, x, k) >= 0) {
+                    sub_into(pm2, e, x, k);
                 } else {
-                    auto idx = std::size_t{this_size - 1 - i};
-                    auto const other_byte = std::uint16_t{i < other_size ? other.data_[other_size - 1 - i] : fill};
-                    auto diff = static_cast<std::int16_t>(
-                        static_cast<std::int16_t>(data_[idx]) - static_cast<std::int16_t>(other_byte) - borrow
-                    );
-                    if (diff < 0) {
-                        diff += 256;
-                        borrow = 1;
-                    } else {
-                        borrow = 0;
+                    auto borrow = limb_type{0};
+                    for (auto i = 0uz; i < e; ++i) {
+                        pm2[i] = sub_borrow(i < k ? x[i] : limb_type{0}, pm2[i], borrow, borrow);
                     }
-                    data_[idx] = static_cast<std::uint8_t>(diff);
+                    m2_negative = true;
                 }
+                return std::pair{m1_negative, m2_negative};
+            };
+
+            auto const squaring = a == b;
+            auto const [am1_negative, am2_negative] = evaluate(a, a1, am1, am2);
+            auto const [bm1_negative, bm2_negative] = squaring ? std::pair{am1_negative, am2_negative}
+                                                               : evaluate(b, b1, bm1, bm2);
+
+            multiply_full(r1, a1, squaring ? a1 : b1, e, rest, thresholds);
+            multiply_full(rm1, am1, squaring ? am1 : bm1, e, rest, thresholds);
+            if (am1_negative != bm1_negative) {
+                negate_n(rm1, w);
             }
-            return *this;
-        }
-
-        template<BitWidth other_bits, Signedness other_signedness>
-        [[nodiscard]] constexpr bigint operator-(bigint<other_bits, other_signedness> const &other) const {
-            auto result = bigint{*this};
-            result -= other;
-            return result;
+            multiply_full(rm2, am2, squaring ? am2 : bm2, e, rest, thresholds);
+            if (am2_negative != bm2_negative) {
+                negate_n(rm2, w);
+            }
+            auto *const r0 = r;
+            auto *const rinf = r + 4 * k;
+            multiply_full(r0, a, b, k, rest, thresholds);
+            multiply_full(rinf, a + 2 * k, b + 2 * k, s, rest, thresholds);
+            std::fill_n(r + 2 * k, 2 * k, limb_type{0});
+
+            // r3 = (r(-2) - r(1)) / 3
+            sub_n(rm2, rm2, r1, w);
+            divide_exact_by_3(rm2, w);
+            // r1 = (r(1) - r(-1)) / 2
+            sub_n(r1, r1, rm1, w);
+            halve_signed(r1, w);
+            // r2 = r(-1) - r(0)
+            sub_into(rm1, w, r0, 2 * k);
+            // r3 = (r2 - r3) / 2 + 2 r(inf)
+            sub_n(rm2, rm1, rm2, w);
+            halve_signed(rm2, w);
+            add_into(rm2, w, rinf, 2 * s);
+            add_into(rm2, w, rinf, 2 * s);
+            // r2 = r2 + r1 - r(inf)
+            add_n(rm1, rm1, r1, w);
+            sub_into(rm1, w, rinf, 2 * s);
+            // r1 = r1 - r3
+            sub_n(r1, r1, rm2, w);
+
+            add_into(r + k, 2 * n - k, r1, std::min(w, 2 * n - k));
+            add_into(r + 2 * k, 2 * n - 2 * k, rm1, std::min(w, 2 * n - 2 * k));
+            add_into(r + 3 * k, 2 * n - 3 * k, rm2, std::min(w, 2 * n - 3 * k));
         }
 
-        template<std::integral T>
-        constexpr bigint &operator/=(T const other) {
-            *this /= bigint{other};
-            return *this;
+        // r[0, 2n) = a[0, n) * b[0, n), scratch holds multiply_scratch(n) limbs.
+        template<std::unsigned_integral limb_type>
+        constexpr void multiply_full(limb_type *const r, limb_type const *const a, limb_type const *const b,
+                                     std::size_t const n, limb_type *const scratch,
+                                     multiply_thresholds const &thresholds) noexcept {
+            switch (select_multiply(n, thresholds)) {
+                case multiply_algorithm::toom3:
+                    multiply_toom3(r, a, b, n, scratch, thresholds);
+                    break;
+                case multiply_algorithm::karatsuba:
+                    multiply_karatsuba(r, a, b, n, scratch, thresholds);
+                    break;
+                default:
+                    if (a == b) {
+                        square_basecase(r, a, n);
+                    } else {
+                        multiply_basecase(r, a, n, b, n);
+                    }
+                    break;
+            }
         }
 
-        template<std::integral T>
-        [[nodiscard]] constexpr bigint operator/(T const other) const {
-            auto result = bigint{*this};
-            result /= other;
-            return result;
+        // r[0, n) = low n limbs of a[0, n) * b[0, n), scratch holds multiply_low_scratch(n) limbs. With a = a1 B^k + a0
+        // the low half is a0 b0 + (a1 b0 + a0 b1) B^k, so one full product of the lower halves plus two low products
+        // of the remaining limbs suffice. That only pays off once the full product no longer uses schoolbook.
+        template<std::unsigned_integral limb_type>
+        constexpr void multiply_low(limb_type *const r, limb_type const *const a, limb_type const *const b,
+                                    std::size_t const n, limb_type *const scratch,
+                                    multiply_thresholds const &thresholds) noexcept {
+            auto const k = (n + 1) / 2;
+            if (select_multiply(k, thresholds) == multiply_algorithm::schoolbook) {
+                if (a == b) {
+                    square_low_basecase(r, a, n);
+                } else {
+                    multiply_low_basecase(r, a, b, n);
+                }
+                return;
+            }
+            auto const m = n - k;
+            auto *const full = scratch;
+            auto *const cross = full + 2 * k;
+            auto *const rest = cross + m;
+            multiply_full(full, a, b, k, rest, thresholds);
+            std::copy_n(full, n, r);
+            multiply_low(cross, a + k, b, m, rest, thresholds);
+            add_into(r + k, m, cross, m);
+            if (a == b) {
+                // Both cross terms are a1 a0.
+                add_into(r + k, m, cross, m);
+            } else {
+                multiply_low(cross, a, b + k, m, rest, thresholds);
+                add_into(r + k, m, cross, m);
+            }
         }
 
-        template<BitWidth other_bits, Signedness other_signedness>
-        constexpr bigint &operator/=(bigint<other_bits, other_signedness> const &other) {
-            if (other == std::int8_t{0}) {
-                throw std::overflow_error("Division by zero");
-            }
+        inline constexpr std::size_t ntt_threshold = bigint_NTT_THRESHOLD;
 
-            auto quotient = bigint{};
-            auto remainder = bigint{};
-            static constexpr auto total_bits = std::to_underlying(bits);
+        // A prime p = c 2^k + 1 with primitive root 3 and p < 2^30. Products are reduced in Montgomery form with
+        // R = 2^32, which needs no division.
+        template<std::uint32_t p>
+        struct ntt_prime {
+            static constexpr std::uint32_t modulus = p;
+            static constexpr std::uint32_t max_log_length = std::countr_zero(p - 1);
 
-            for (auto const i: std::views::reverse(std::views::iota(0uz, total_bits))) {
-                remainder <<= std::int8_t{1};
-                if (this->get_bit(i)) {
-                    remainder += std::int8_t{1};
-                }
-                if (remainder >= other) {
-                    remainder -= other;
-                    quotient.set_bit(i, true);
+            // -p^-1 mod 2^32, every Newton step doubles the number of correct bits.
+            static constexpr std::uint32_t negative_inverse = [] {
+                auto inverse = p;
+                for (auto i = 0; i < 4; ++i) {
+                    inverse *= 2 - p * inverse;
                 }
+                return static_cast<std::uint32_t>(0 - inverse);
+            }();
+
+            // R^2 mod p, multiplying by it converts into Montgomery form.
+            static constexpr std::uint32_t r_squared = [] {
+                auto const r = (std::uint64_t{1} << 32) % p;
+                return static_cast<std::uint32_t>(r * r % p);
+            }();
+
+            // value R^-1 mod p in [0, 2p) for value < p 2^32, the final correction is left to the caller.
+            [[nodiscard]] static constexpr std::uint32_t reduce_lazy(std::uint64_t const value) noexcept {
+                auto const m = static_cast<std::uint32_t>(static_cast<std::uint32_t>(value) * negative_inverse);
+                return static_cast<std::uint32_t>((value + std::uint64_t{m} * p) >> 32);
             }
-            *this = quotient;
-            return *this;
-        }
-
-        template<BitWidth other_bits, Signedness other_signedness>
-        [[nodiscard]] constexpr bigint operator/(bigint<other_bits, other_signedness> const &other) const {
-            auto result = bigint{*this};
-            result /= other;
-            return result;
-        }
 
-        template<std::integral T>
-        constexpr bigint &operator%=(T const other) {
-            *this %= bigint{other};
-            return *this;
-        }
+            [[nodiscard]] static constexpr std::uint32_t normalize(std::uint32_t const value) noexcept {
+                return value >= p ? value - p : value;
+            }
 
-        template<std::integral T>
-        [[nodiscard]] constexpr bigint operator%(T const other) const {
-            auto result = bigint{*this};
-            result %= other;
-            return result;
-        }
+            // a b R^-1 mod p in [0, 2p) for a, b < 2p, which is exact because 4p^2 < p 2^32.
+            [[nodiscard]] static constexpr std::uint32_t multiply_lazy(std::uint32_t const a,
+                                                                       std::uint32_t const b) noexcept {
+                return reduce_lazy(std::uint64_t{a} * b);
+            }
 
-        template<BitWidth other_bits, Signedness other_signedness>
-        constexpr bigint &operator%=(bigint<other_bits, other_signedness> const &other) {
-            if (other == std::int8_t{0}) {
-                throw std::overflow_error("Division by zero");
+            // a b R^-1 mod p
+            [[nodiscard]] static constexpr std::uint32_t multiply(std::uint32_t const a, std::uint32_t const b) noexcept {
+                return normalize(multiply_lazy(a, b));
             }
 
-            auto quotient = bigint{};
-            auto remainder = bigint{};
-            static constexpr auto total_bits = std::to_underlying(bits);
+            [[nodiscard]] static constexpr std::uint32_t to_montgomery(std::uint32_t const value) noexcept {
+                return multiply(value % p, r_squared);
+            }
 
-            for (auto const i: std::views::reverse(std::views::iota(0uz, total_bits))) {
-                remainder <<= std::int8_t{1};
-                if (this->get_bit(i)) {
-                    remainder += std::int8_t{1};
+            // base^exponent for base in Montgomery form, the result is in Montgomery form as well.
+            [[nodiscard]] static constexpr std::uint32_t power(std::uint32_t base, std::uint64_t exponent) noexcept {
+                auto result = to_montgomery(1);
+                for (; exponent != 0; exponent >>= 1) {
+                    if ((exponent & 1) != 0) {
+                        result = multiply(result, base);
+                    }
+                    base = multiply(base, base);
                 }
+                return result;
+            }
 
-                if (remainder >= other) {
-                    remainder -= other;
+            // Twiddle factors in Montgomery form, laid out so that the butterflies of a span read them contiguously:
+            // entries [half, 2 half) hold w^0 ... w^(half - 1) for a primitive 2 half-th root of unity w, or of its
+            // inverse. Only the top span is computed, in interleaved chains so the multiplications do not wait on
+            // each other, every smaller span takes every other root of the one above.
+            [[nodiscard]] static constexpr std::vector<std::uint32_t> roots(std::size_t const length, bool const inverse) {
+                constexpr auto chains = 16uz;
+                auto result = std::vector<std::uint32_t>(length);
+                auto const half = length / 2;
+                auto const root = power(to_montgomery(3), (p - 1) / length);
+                auto const step = inverse ? power(root, length - 1) : root;
+                auto *const top = result.data() + half;
+                top[0] = to_montgomery(1);
+                for (auto j = 1uz; j < std::min(half, chains); ++j) {
+                    top[j] = multiply(top[j - 1], step);
                 }
+                auto const jump = power(step, chains);
+                for (auto j = chains; j < half; ++j) {
+                    top[j] = multiply(top[j - chains], jump);
+                }
+                for (auto span = half / 2; span >= 1; span /= 2) {
+                    for (auto j = 0uz; j < span; ++j) {
+                        result[span + j] = result[2 * span + 2 * j];
+                    }
+                }
+                return result;
             }
-            *this = remainder;
-            return *this;
-        }
-
-        template<BitWidth other_bits, Signedness other_signedness>
-        [[nodiscard]] constexpr bigint operator%(bigint<other_bits, other_signedness> const &other) const {
-            auto result = bigint{*this};
-            result %= other;
-            return result;
-        }
 
-        constexpr bigint &operator<<=(std::size_t const shift) {
-            static constexpr auto n = std::size_t{std::to_underlying(bits) / CHAR_BIT};
-            if (shift == 0) {
-                return *this;
+            // Decimation in frequency, natural order in, bit-reversed order out. Values stay in normal form because
+            // the roots are in Montgomery form, and in [0, 2p) between the stages so that only the sum needs a
+            // correction.
+            static constexpr void forward(std::vector<std::uint32_t> &values, std::vector<std::uint32_t> const &roots) noexcept {
+                auto const length = values.size();
+                for (auto half = length / 2; half >= 1; half /= 2) {
+                    auto const *const twiddles = roots.data() + half;
+                    for (auto i = 0uz; i < length; i += 2 * half) {
+                        auto *const low = values.data() + i;
+                        auto *const high = low + half;
+                        for (auto j = 0uz; j < half; ++j) {
+                            auto const u = low[j];
+                            auto const v = high[j];
+                            auto const sum = u + v;
+                            low[j] = sum >= 2 * p ? sum - 2 * p : sum;
+                            high[j] = multiply_lazy(u - v + 2 * p, twiddles[j]);
+                        }
+                    }
+                }
             }
 
-            auto const byte_shift = std::size_t{shift / CHAR_BIT};
-            auto const bit_shift = std::size_t{shift % CHAR_BIT};
-            auto result = std::array<std::uint8_t, n>{};
+            // Decimation in time, bit-reversed order in, natural order out, without the division by the length.
+            static constexpr void inverse(std::vector<std::uint32_t> &values, std::vector<std::uint32_t> const &roots) noexcept {
+                auto const length = values.size();
+                for (auto half = 1uz; half < length; half *= 2) {
+                    auto const *const twiddles = roots.data() + half;
+                    for (auto i = 0uz; i < length; i += 2 * half) {
+                        auto *const low = values.data() + i;
+                        auto *const high = low + half;
+                        for (auto j = 0uz; j < half; ++j) {
+                            auto const u = low[j];
+                            auto const v = multiply_lazy(high[j], twiddles[j]);
+                            auto const sum = u + v;
+                            auto const difference = u - v + 2 * p;
+                            low[j] = sum >= 2 * p ? sum - 2 * p : sum;
+                            high[j] = difference >= 2 * p ? difference - 2 * p : difference;
+                        }
+                    }
+                }
+            }
 
-            for (auto const i: std::views::iota(0uz, n)) {
-                if constexpr (std::endian::native == std::endian::little) {
-                    if (i + byte_shift < n) {
-                        result[i + byte_shift] = data_[i];
+            // Cyclic convolution of the 32-bit digits of a and b modulo p over length points, in [0, 2p).
+            template<std::unsigned_integral limb_type>
+            [[nodiscard]] static constexpr std::vector<std::uint32_t> convolve(limb_type const *const a,
+                                                                               limb_type const *const b,
+                                                                               std::size_t const n,
+                                                                               std::size_t const length) {
+                constexpr auto digits_per_limb = sizeof(limb_type) / sizeof(std::uint32_t);
+                // The pointwise products carry a factor R^-1 and the inverse transform a factor length. Loading the
+                // digits of a multiplied by R^2 / length in Montgomery form removes both, and reduces them as well.
+                auto const length_inverse = power(to_montgomery(static_cast<std::uint32_t>(length % p)), p - 2);
+                auto const scale = multiply(length_inverse, r_squared);
+                auto const load = [n, length](limb_type const *const limbs, std::uint32_t const factor) {
+                    auto result = std::vector<std::uint32_t>(length);
+                    for (auto i = 0uz; i < n * digits_per_limb; ++i) {
+                        auto const digit = static_cast<std::uint32_t>(limbs[i / digits_per_limb] >> (i % digits_per_limb * 32));
+                        result[i] = multiply_lazy(digit, factor);
                     }
-                } else {
-                    if (i >= byte_shift) {
-                        result[i - byte_shift] = data_[i];
+                    return result;
+                };
+                auto const forward_roots = roots(length, false);
+                if (a == b) {
+                    // A square transforms its operand once and applies the scale factor to the products.
+                    auto x = load(a, to_montgomery(1));
+                    forward(x, forward_roots);
+                    for (auto &value: x) {
+                        value = multiply_lazy(multiply_lazy(value, value), scale);
                     }
+                    inverse(x, roots(length, true));
+                    return x;
+                }
+                auto x = load(a, scale);
+                auto y = load(b, to_montgomery(1));
+                forward(x, forward_roots);
+                forward(y, forward_roots);
+                for (auto i = 0uz; i < length; ++i) {
+                    x[i] = multiply_lazy(x[i], y[i]);
                 }
+                inverse(x, roots(length, true));
+                return x;
             }
-
-            auto carry = std::uint16_t{0};
-            for (auto const i: std::views::iota(0uz, n)) {
-                auto const temp = static_cast<std::uint16_t>(
-                    (static_cast<std::uint16_t>(result[i]) << bit_shift) | carry);
-                result[i] = static_cast<std::uint8_t>(temp & 0xFF);
-                carry = temp >> 8;
+        };
+
+        using ntt_prime_1 = ntt_prime<998244353>; // 119 * 2^23 + 1
+        using ntt_prime_2 = ntt_prime<167772161>; // 5 * 2^25 + 1
+        using ntt_prime_3 = ntt_prime<469762049>; // 7 * 2^26 + 1
+
+        // Convolution coefficients of m 32-bit digits stay below m 2^64 and have to be below p1 p2 p3 > 2^86.
+        inline constexpr std::size_t ntt_max_log_length = 22;
+        static_assert(ntt_max_log_length <= ntt_prime_1::max_log_length);
+
+        [[nodiscard]] constexpr std::uint64_t power_mod(std::uint64_t base, std::uint64_t exponent,
+                                                        std::uint64_t const modulus) noexcept {
+            auto result = std::uint64_t{1};
+            for (base %= modulus; exponent != 0; exponent >>= 1) {
+                if ((exponent & 1) != 0) {
+                    result = result * base % modulus;
+                }
+                base = base * base % modulus;
             }
-
-            data_ = result;
-            return *this;
-        }
-
-        [[nodiscard]] constexpr bigint operator<<(std::size_t const shift) const {
-            auto result = bigint{*this};
-            result <<= shift;
             return result;
         }
 
-        constexpr bigint &operator>>=(std::size_t const shift) {
-            static constexpr auto n = std::size_t{std::to_underlying(bits) / CHAR_BIT};
-            if (shift == 0) {
-                return *this;
-            }
-
-            auto fill = std::uint8_t{0};
-            if constexpr (signedness == Signedness::Signed) {
-                if constexpr (std::endian::native == std::endian::little) {
-                    if (data_[n - 1] & 0x80) {
-                        fill = 0xFF;
-                    }
-                } else {
-                    if (data_[0] & 0x80) {
-                        fill = 0xFF;
-                    }
-                }
+        // The transform needs limbs of at least 32 bits and stays exact up to 2^21 digits per operand.
+        template<std::unsigned_integral limb_type>
+        [[nodiscard]] constexpr bool use_ntt(std::size_t const n) noexcept {
+            if constexpr (sizeof(limb_type) < sizeof(std::uint32_t)) {
+                return false;
+            } else {
+                constexpr auto digits_per_limb = sizeof(limb_type) / sizeof(std::uint32_t);
+                return n >= ntt_threshold and 2 * n * digits_per_limb <= std::size_t{1} << ntt_max_log_length;
             }
+        }
 
-            if (shift >= std::to_underlying(bits)) {
-                data_.fill(fill);
-                return *this;
+        // r[0, rn) = low rn limbs of a[0, n) * b[0, n) for rn <= 2n. The 32-bit digits are convolved modulo three
+        // primes and every coefficient is recombined with Garner's algorithm before the carries are propagated.
+        template<std::unsigned_integral limb_type>
+        constexpr void multiply_ntt(limb_type *const r, limb_type const *const a, limb_type const *const b,
+                                    std::size_t const n, std::size_t const rn) {
+            static_assert(sizeof(limb_type) >= sizeof(std::uint32_t), "The transform works on 32-bit digits.");
+            constexpr auto digits_per_limb = sizeof(limb_type) / sizeof(std::uint32_t);
+            constexpr auto p1 = std::uint64_t{ntt_prime_1::modulus};
+            constexpr auto p2 = std::uint64_t{ntt_prime_2::modulus};
+            constexpr auto p3 = std::uint64_t{ntt_prime_3::modulus};
+            constexpr auto p1_inverse_mod_p2 = power_mod(p1, p2 - 2, p2);
+            constexpr auto p1_inverse_mod_p3 = power_mod(p1, p3 - 2, p3);
+            constexpr auto p2_inverse_mod_p3 = power_mod(p2, p3 - 2, p3);
+
+            auto const digits = n * digits_per_limb;
+            auto const length = std::bit_ceil(2 * digits);
+            auto const c1 = ntt_prime_1::convolve(a, b, n, length);
+            auto const c2 = ntt_prime_2::convolve(a, b, n, length);
+            auto const c3 = ntt_prime_3::convolve(a, b, n, length);
+
+            // The running sum of coefficient and carry needs up to 88 bits, kept as low and high words.
+            auto carry_low = std::uint64_t{0};
+            auto carry_high = std::uint64_t{0};
+            std::fill_n(r, rn, limb_type{0});
+            for (auto i = 0uz; i < rn * digits_per_limb; ++i) {
+                auto const x1 = std::uint64_t{ntt_prime_1::normalize(c1[i])};
+                auto const x2 = (ntt_prime_2::normalize(c2[i]) + p2 - x1 % p2) % p2 * p1_inverse_mod_p2 % p2;
+                auto const x3 = ((ntt_prime_3::normalize(c3[i]) + p3 - x1 % p3) % p3 * p1_inverse_mod_p3 % p3 + p3 - x2 % p3) % p3 *
+                                p2_inverse_mod_p3 % p3;
+                auto const top = mul_wide(p1 * p2, x3);
+                auto first = std::uint64_t{0};
+                auto second = std::uint64_t{0};
+                auto const low = add_carry(top.low, x1 + p1 * x2, std::uint64_t{0}, first);
+                carry_low = add_carry(carry_low, low, std::uint64_t{0}, second);
+                carry_high += top.high + first + second;
+
+                r[i / digits_per_limb] |= static_cast<limb_type>(static_cast<limb_type>(static_cast<std::uint32_t>(carry_low))
+                                                                 << (i % digits_per_limb * 32));
+                carry_low = (carry_low >> 32) | (carry_high << 32);
+                carry_high >>= 32;
             }
+        }
 
-            auto const byte_shift = std::size_t{shift / CHAR_BIT};
-            auto const bit_shift = std::size_t{shift % CHAR_BIT};
-            auto result = std::array<std::uint8_t, n>{};
-
-            for (auto const i: std::views::iota(0uz, n)) {
-                if constexpr (std::endian::native == std::endian::little) {
-                    auto const lower = (i + byte_shift < n) ? data_[i + byte_shift] : fill;
-                    auto const upper = (i + byte_shift + 1 < n) ? data_[i + byte_shift + 1] : fill;
-                    if (bit_shift == 0) {
-                        result[i] = lower;
-                    } else {
-                        result[i] = static_cast<std::uint8_t>((lower >> bit_shift) | (upper << (8 - bit_shift)));
-                    }
+        // r[0, an + bn) = a[0, an) * b[0, bn), the full product without any truncation. Equally sized operands take
+        // the same algorithms as operator*=, passing the same array twice selects the squaring kernels.
+        template<std::unsigned_integral limb_type, std::size_t an, std::size_t bn>
+        constexpr void multiply_product(std::array<limb_type, an + bn> &r, std::array<limb_type, an> const &a,
+                                        std::array<limb_type, bn> const &b) {
+            constexpr auto &thresholds = default_multiply_thresholds;
+            if constexpr (an != bn) {
+                multiply_basecase(r.data(), a.data(), an, b.data(), bn);
+            } else if constexpr (use_ntt<limb_type>(an)) {
+                multiply_ntt(r.data(), a.data(), b.data(), an, 2 * an);
+            } else if constexpr (constexpr auto scratch_size = multiply_scratch(an, thresholds); scratch_size == 0) {
+                if (a.data() == b.data()) {
+                    square_basecase(r.data(), a.data(), an);
                 } else {
-                    auto const src = static_cast<int>(i) - static_cast<int>(byte_shift);
-                    auto const lower = (src >= 0 and static_cast<std::size_t>(src) < n) ? data_[src] : fill;
-                    auto const src2 = src - 1;
-                    auto const higher = (src2 >= 0 and static_cast<std::size_t>(src2) < n) ? data_[src2] : fill;
-                    if (bit_shift == 0) {
-                        result[i] = lower;
-                    } else {
-                        result[i] = static_cast<std::uint8_t>((lower >> bit_shift) | (higher << (8 - bit_shift)));
-                    }
+                    multiply_basecase(r.data(), a.data(), an, b.data(), an);
                 }
+            } else {
+                std::array<limb_type, scratch_size> scratch;
+                multiply_full(r.data(), a.data(), b.data(), an, scratch.data(), thresholds);
             }
+        }
 
-            data_ = result;
-            return *this;
+        // -m^-1 mod B for an odd limb m, every Newton step doubles the number of correct bits.
+        template<std::unsigned_integral limb_type>
+        [[nodiscard]] constexpr limb_type negative_inverse(limb_type const m) noexcept {
+            constexpr auto limb_bits = std::size_t{sizeof(limb_type) * CHAR_BIT};
+            // m m = 1 mod 8 for every odd m, so m is its own inverse to three bits.
+            auto inverse = m;
+            for (auto correct = 3uz; correct < limb_bits; correct *= 2) {
+                inverse = static_cast<limb_type>(inverse * static_cast<limb_type>(2 - static_cast<limb_type>(m * inverse)));
+            }
+            return static_cast<limb_type>(0 - inverse);
         }
 
-        [[nodiscard]] constexpr bigint operator>>(std::size_t const shift) const {
-            auto result = bigint{*this};
-            result >>= shift;
+        // a + b mod m for a, b < m.
+        template<std::unsigned_integral limb_type, std::size_t n>
+        [[nodiscard]] constexpr std::array<limb_type, n> add_mod(std::array<limb_type, n> const &a,
+                                                                 std::array<limb_type, n> const &b,
+                                                                 std::array<limb_type, n> const &m) noexcept {
+            auto result = a;
+            if (add_limbs(result, b) != 0 or compare_n(result.data(), n, m.data(), n) >= 0) {
+                sub_limbs(result, m);
+            }
             return result;
         }
 
-        [[nodiscard]] constexpr bigint operator+() const {
-            return *this;
+        // a - b mod m for a, b < m.
+        template<std::unsigned_integral limb_type, std::size_t n>
+        [[nodiscard]] constexpr std::array<limb_type, n> sub_mod(std::array<limb_type, n> const &a,
+                                                                 std::array<limb_type, n> const &b,
+                                                                 std::array<limb_type, n> const &m) noexcept {
+            auto result = a;
+            if (sub_limbs(result, b) != 0) {
+                add_limbs(result, m);
+            }
+            return result;
         }
 
-        [[nodiscard]] constexpr bigint operator-() const {
-            auto min_value = bigint{};
-            if constexpr (std::endian::native == std::endian::little) {
-                min_value.data_.back() = 0x80;
-            } else {
-                min_value.data_.front() = 0x80;
+        // a b R^-1 mod m for a, b < m, R = B^n and inverse = -m^-1 mod B. Coarsely integrated operand scanning (Koc,
+        // Acar and Kaliski, "Analyzing and comparing Montgomery multiplication algorithms"): each row of the product
+        // is reduced as soon as it has been added, so the running value never needs more than n + 2 limbs.
+        template<std::unsigned_integral limb_type, std::size_t n>
+        [[nodiscard]] constexpr std::array<limb_type, n> montgomery_multiply(std::array<limb_type, n> const &a,
+                                                                             std::array<limb_type, n> const &b,
+                                                                             std::array<limb_type, n> const &m,
+                                                                             limb_type const inverse) noexcept {
+            auto t = std::array<limb_type, n + 2>{};
+            for (auto i = 0uz; i < n; ++i) {
+                auto carry = limb_type{0};
+                auto overflow = limb_type{0};
+                for (auto j = 0uz; j < n; ++j) {
+                    auto const product = mul_wide(a[j], b[i]);
+                    auto const low = add_carry(product.low, carry, limb_type{0}, overflow);
+                    auto const high = static_cast<limb_type>(product.high + overflow);
+                    t[j] = add_carry(t[j], low, limb_type{0}, overflow);
+                    carry = static_cast<limb_type>(high + overflow);
+                }
+                t[n] = add_carry(t[n], carry, limb_type{0}, overflow);
+                t[n + 1] = overflow;
+
+                // t = (t + factor m) / B, the factor makes the lowest limb vanish.
+                auto const factor = static_cast<limb_type>(t[0] * inverse);
+                auto product = mul_wide(factor, m[0]);
+                static_cast<void>(add_carry(t[0], product.low, limb_type{0}, overflow));
+                carry = static_cast<limb_type>(product.high + overflow);
+                for (auto j = 1uz; j < n; ++j) {
+                    product = mul_wide(factor, m[j]);
+                    auto const low = add_carry(product.low, carry, limb_type{0}, overflow);
+                    auto const high = static_cast<limb_type>(product.high + overflow);
+                    t[j - 1] = add_carry(t[j], low, limb_type{0}, overflow);
+                    carry = static_cast<limb_type>(high + overflow);
+                }
+                t[n - 1] = add_carry(t[n], carry, limb_type{0}, overflow);
+                t[n] = static_cast<limb_type>(t[n + 1] + overflow);
             }
 
-            if (*this == min_value) {
-                throw std::overflow_error("Negation overflow: minimum value cannot be negated");
+            auto result = std::array<limb_type, n>{};
+            std::copy_n(t.begin(), n, result.begin());
+            if (t[n] != 0 or compare_n(result.data(), n, m.data(), n) >= 0) {
+                sub_limbs(result, m);
             }
-
-            auto result = ~*this;
-            result += static_cast<std::int8_t>(1);
             return result;
         }
 
-        constexpr bigint &operator++() {
-            *this += 1;
-            return *this;
-        }
+        // t R^-1 mod m for t < m R (Montgomery's REDC), one limb of t is cancelled per row.
+        template<std::unsigned_integral limb_type, std::size_t n>
+        [[nodiscard]] constexpr std::array<limb_type, n> montgomery_reduce(std::array<limb_type, 2 * n> t,
+                                                                           std::array<limb_type, n> const &m,
+                                                                           limb_type const inverse) noexcept {
+            auto top = limb_type{0};
+            for (auto i = 0uz; i < n; ++i) {
+                auto const factor = static_cast<limb_type>(t[i] * inverse);
+                auto carry = limb_type{0};
+                auto overflow = limb_type{0};
+                for (auto j = 0uz; j < n; ++j) {
+                    auto const product = mul_wide(factor, m[j]);
+                    auto const low = add_carry(product.low, carry, limb_type{0}, overflow);
+                    auto const high = static_cast<limb_type>(product.high + overflow);
+                    t[i + j] = add_carry(t[i + j], low, limb_type{0}, overflow);
+                    carry = static_cast<limb_type>(high + overflow);
+                }
+                // The carry out of this row lands one limb further up with the next row's carry.
+                t[i + n] = add_carry(t[i + n], carry, top, top);
+            }
 
-        constexpr bigint operator++(int) {
-            auto result = bigint{*this};
-            ++*this;
+            auto result = std::array<limb_type, n>{};
+            std::copy_n(t.begin() + n, n, result.begin());
+            if (top != 0 or compare_n(result.data(), n, m.data(), n) >= 0) {
+                sub_limbs(result, m);
+            }
             return result;
         }
 
-        constexpr bigint &operator--() {
-            *this -= 1;
-            return *this;
+        // a^2 R^-1 mod m for a < m. The full square is computed first, so it gets the squaring kernels.
+        template<std::unsigned_integral limb_type, std::size_t n>
+        [[nodiscard]] constexpr std::array<limb_type, n> montgomery_square(std::array<limb_type, n> const &a,
+                                                                           std::array<limb_type, n> const &m,
+                                                                           limb_type const inverse) {
+            auto t = std::array<limb_type, 2 * n>{};
+            multiply_product(t, a, a);
+            return montgomery_reduce(t, m, inverse);
         }
 
-        constexpr bigint operator--(int) {
-            auto result = bigint{*this};
-            --*this;
+        // Value of every character as a digit in bases up to 36, or 36 for anything that is not a digit.
+        inline constexpr std::array<std::uint8_t, 256> digit_values = [] {
+            auto result = std::array<std::uint8_t, 256>{};
+            result.fill(36);
+            for (auto i = 0; i < 10; ++i) {
+                result['0' + i] = static_cast<std::uint8_t>(i);
+            }
+            for (auto i = 0; i < 26; ++i) {
+                result['a' + i] = static_cast<std::uint8_t>(10 + i);
+                result['A' + i] = static_cast<std::uint8_t>(10 + i);
+            }
             return result;
-        }
+        }();
 
-        [[nodiscard]] constexpr bigint operator&(bigint const &other) const {
-            auto result = bigint{*this};
-            result &= other;
-            return result;
+        [[nodiscard]] constexpr std::uint8_t digit_value(char const c) noexcept {
+            return digit_values[static_cast<unsigned char>(c)];
         }
 
-        constexpr bigint &operator&=(bigint const &other) {
-            for (auto const i: std::views::iota(0uz, data_.size())) {
-                data_[i] &= other.data_[i];
+        // Largest power of base that fits a limb together with its exponent.
+        template<std::unsigned_integral limb_type>
+        struct radix_chunk {
+            limb_type power;
+            std::size_t digits;
+
+            constexpr explicit radix_chunk(limb_type const base) noexcept : power{base}, digits{1} {
+                while (power <= std::numeric_limits<limb_type>::max() / base) {
+                    power = static_cast<limb_type>(power * base);
+                    ++digits;
+                }
             }
-            return *this;
+        };
+
+        // limbs[0, size) = limbs[0, size) * multiplier + addend. The limb count grows while there is room, a carry
+        // that does not fit is returned.
+        template<std::unsigned_integral limb_type, std::size_t capacity>
+        constexpr limb_type multiply_add(std::array<limb_type, capacity> &limbs, std::size_t &size,
+                                         limb_type const multiplier, limb_type const addend) noexcept {
+            auto carry = addend;
+            for (auto i = 0uz; i < size; ++i) {
+                auto const product = mul_wide(limbs[i], multiplier);
+                auto overflow = limb_type{0};
+                limbs[i] = add_carry(product.low, carry, limb_type{0}, overflow);
+                carry = static_cast<limb_type>(product.high + overflow);
+            }
+            if (carry != 0 and size < capacity) {
+                limbs[size++] = carry;
+                carry = 0;
+            }
+            return carry;
         }
 
-        [[nodiscard]] constexpr bigint operator|(bigint const &other) const {
-            auto result = bigint{*this};
-            result |= other;
+        // Eight characters loaded into a word, the first one in the lowest byte.
+        [[nodiscard]] constexpr std::uint64_t load_eight(char const *const first) noexcept {
+            auto result = std::uint64_t{0};
+            for (auto i = 0uz; i < 8; ++i) {
+                result |= std::uint64_t{static_cast<std::uint8_t>(first[i])} << (i * CHAR_BIT);
+            }
             return result;
         }
 
-        constexpr bigint &operator|=(bigint const &other) {
-            for (auto const i: std::views::iota(0uz, data_.size())) {
-                data_[i] |= other.data_[i];
-            }
-            return *this;
+        // SWAR check that all eight characters loaded by load_eight are decimal digits.
+        [[nodiscard]] constexpr bool eight_decimal_digits(std::uint64_t const word) noexcept {
+            return (((word + 0x4646464646464646) | (word - 0x3030303030303030)) & 0x8080808080808080) == 0;
         }
 
-        [[nodiscard]] constexpr bigint operator^(bigint const &other) const {
-            auto result = bigint{*this};
-            result ^= other;
-            return result;
+        // SWAR conversion of eight decimal digits loaded by load_eight into their value.
+        [[nodiscard]] constexpr std::uint32_t parse_eight_decimal_digits(std::uint64_t word) noexcept {
+            constexpr auto mask = std::uint64_t{0x000000FF000000FF};
+            constexpr auto mul1 = std::uint64_t{100 + (1000000ULL << 32)};
+            constexpr auto mul2 = std::uint64_t{1 + (10000ULL << 32)};
+            word -= 0x3030303030303030;
+            word = word * 10 + (word >> 8);
+            return static_cast<std::uint32_t>(((word & mask) * mul1 + ((word >> 16) & mask) * mul2) >> 32);
         }
 
-        constexpr bigint &operator^=(bigint const &other) {
-            for (auto const i: std::views::iota(0uz, data_.size())) {
-                data_[i] ^= other.data_[i];
+        enum class parse_status {
+            ok,
+            invalid_digit,
+            overflow,
+        };
+
+        // Places the digits of base 2^shift straight into the limbs, starting with the least significant one. Runs of
+        // digits that fill a whole limb are gathered without any per-digit checks.
+        template<std::size_t shift, std::unsigned_integral limb_type, std::size_t size>
+        constexpr parse_status parse_power_of_two(std::array<limb_type, size> &limbs, char const *const first,
+                                                  char const *const last, bool const separators) noexcept {
+            constexpr auto limb_bits = std::size_t{sizeof(limb_type) * CHAR_BIT};
+            constexpr auto limb_digits = limb_bits % shift == 0 ? limb_bits / shift : 0;
+            constexpr auto base = std::uint8_t{1u << shift};
+            auto limb = limb_type{0};
+            auto filled = 0uz;
+            auto index = 0uz;
+            for (auto it = last; it != first;) {
+                if constexpr (limb_digits != 0) {
+                    if (filled == 0 and static_cast<std::size_t>(it - first) >= limb_digits) {
+                        auto block = limb_type{0};
+                        auto seen = std::uint8_t{0};
+                        for (auto i = 0uz; i < limb_digits; ++i) {
+                            auto const digit = digit_value(*(it - 1 - i));
+                            seen |= digit;
+                            block |= static_cast<limb_type>(static_cast<limb_type>(digit) << (i * shift));
+                        }
+                        // A separator or an invalid digit falls through to the per-character path below.
+                        if (seen < base) {
+                            if (index < size) {
+                                limbs[index] = block;
+                            } else if (block != 0) {
+                                return parse_status::overflow;
+                            }
+                            ++index;
+                            it -= limb_digits;
+                            continue;
+                        }
+                    }
+                }
+
+                auto const c = *--it;
+                if (separators and (c == '\'' or c == ' ')) {
+                    continue;
+                }
+                auto const digit = static_cast<limb_type>(digit_value(c));
+                if (digit >= base) {
+                    return parse_status::invalid_digit;
+                }
+                limb |= static_cast<limb_type>(digit << filled);
+                filled += shift;
+                if (filled >= limb_bits) {
+                    if (index < size) {
+                        limbs[index] = limb;
+                    } else if (limb != 0) {
+                        return parse_status::overflow;
+                    }
+                    ++index;
+                    filled -= limb_bits;
+                    limb = filled == 0 ? limb_type{0} : static_cast<limb_type>(digit >> (shift - filled));
+                }
             }
-            return *this;
+            if (limb != 0) {
+                if (index >= size) {
+                    return parse_status::overflow;
+                }
+                limbs[index] = limb;
+            }
+            return parse_status::ok;
         }
 
-        [[nodiscard]] constexpr bigint operator~() const {
-            auto result = bigint{*this};
-            for (auto &byte: result.data_) {
-                byte = ~byte;
+        // Collects radix_chunk digits in a single limb before folding them in with one multiply_add. Decimal input is
+        // consumed eight digits at a time whenever they fit the chunk.
+        template<std::unsigned_integral limb_type, std::size_t size>
+        constexpr parse_status parse_radix(std::array<limb_type, size> &limbs, char const *first,
+                                           char const *const last, std::uint8_t const base,
+                                           bool const separators) noexcept {
+            auto const chunk = radix_chunk<limb_type>{base};
+            auto used = 0uz;
+            auto multiplier = limb_type{1};
+            auto addend = limb_type{0};
+            auto count = 0uz;
+            while (first != last) {
+                auto eight = false;
+                if constexpr (std::numeric_limits<limb_type>::digits10 >= 8) {
+                    eight = base == 10 and count + 8 <= chunk.digits and last - first >= 8 and
+                            eight_decimal_digits(load_eight(first));
+                }
+                if (eight) {
+                    addend = static_cast<limb_type>(addend * 100000000 + parse_eight_decimal_digits(load_eight(first)));
+                    multiplier = static_cast<limb_type>(multiplier * 100000000);
+                    count += 8;
+                    first += 8;
+                } else {
+                    auto const c = *first++;
+                    if (separators and (c == '\'' or c == ' ')) {
+                        continue;
+                    }
+                    auto const digit = digit_value(c);
+                    if (digit >= base) {
+                        return parse_status::invalid_digit;
+                    }
+                    addend = static_cast<limb_type>(addend * base + digit);
+                    multiplier = static_cast<limb_type>(multiplier * base);
+                    ++count;
+                }
+                if (count == chunk.digits) {
+                    if (multiply_add(limbs, used, multiplier, addend) != 0) {
+                        return parse_status::overflow;
+                    }
+                    multiplier = 1;
+                    addend = 0;
+                    count = 0;
+                }
             }
-            return result;
+            if (count != 0 and multiply_add(limbs, used, multiplier, addend) != 0) {
+                return parse_status::overflow;
+            }
+            return parse_status::ok;
         }
 
-        template<BitWidth other_bits, Signedness other_is_signed>
-        friend class bigint;
+        // Accumulates the digits in [first, last), most significant first, into zeroed limbs. When separators is set
+        // ' and space characters are skipped.
+        template<std::unsigned_integral limb_type, std::size_t size>
+        constexpr parse_status parse_digits(std::array<limb_type, size> &limbs, char const *const first,
+                                            char const *const last, std::uint8_t const base,
+                                            bool const separators) noexcept {
+            switch (base) {
+                case 2:
+                    return parse_power_of_two<1>(limbs, first, last, separators);
+                case 4:
+                    return parse_power_of_two<2>(limbs, first, last, separators);
+                case 8:
+                    return parse_power_of_two<3>(limbs, first, last, separators);
+                case 16:
+                    return parse_power_of_two<4>(limbs, first, last, separators);
+                case 32:
+                    return parse_power_of_two<5>(limbs, first, last, separators);
+                default:
+                    return parse_radix(limbs, first, last, base, separators);
+            }
+        }
+    }
+
+    template<BitWidth bits, Signedness signedness>
+    class bigint;
+
+    namespace detail {
+        struct limb_access;
+
+        // Type of the full product of two bigints: wide enough for any product and signed if either operand is.
+        template<BitWidth a_bits, Signedness a_signedness, BitWidth b_bits, Signedness b_signedness>
+        using widening_product = bigint<BitWidth{std::to_underlying(a_bits) + std::to_underlying(b_bits)},
+                                        a_signedness == Signedness::Signed or b_signedness == Signedness::Signed
+                                            ? Signedness::Signed
+                                            : Signedness::Unsigned>;
+    }
+
+    template<BitWidth bits, Signedness signedness>
+    class bigint final {
+    public:
+        using limb_type = detail::limb_for<std::to_underlying(bits)>;
+        static constexpr std::size_t limb_bits = sizeof(limb_type) * CHAR_BIT;
+        static constexpr std::size_t limb_count = std::to_underlying(bits) / limb_bits;
+
+    private:
+        static_assert(std::to_underlying(bits) % CHAR_BIT == 0, "bits must be a multiple of CHAR_BIT");
+        static_assert(std::to_underlying(bits) > 0, "bits must not be zero");
+        std::array<limb_type, limb_count> data_{};
+
+    public:
+        [[nodiscard]] constexpr bigint() = default;
+
+        template<std::integral T>
+        [[nodiscard]] constexpr bigint(T const data) {
+            static_assert(std::to_underlying(bits) / CHAR_BIT >= sizeof(T),
+                          "Can't assign values with a larger bit count than the target type.");
+            using wide_type = std::conditional_t<std::is_signed_v<T>, std::intmax_t, std::uintmax_t>;
+            constexpr auto value_limbs = std::min(limb_count, sizeof(std::uintmax_t) / sizeof(limb_type));
+
+            auto fill = limb_type{0};
+            if constexpr (std::is_signed_v<T>) {
+                fill = (data < 0 ? static_cast<limb_type>(~limb_type{0}) : limb_type{0});
+            }
+            data_.fill(fill);
+
+            auto const value = static_cast<std::uintmax_t>(static_cast<wide_type>(data));
+            for (auto const i: std::views::iota(0uz, value_limbs)) {
+                data_[i] = static_cast<limb_type>(value >> (i * limb_bits));
+            }
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        [[nodiscard]] constexpr bigint(bigint<other_bits, other_signedness> const &other) {
+            static_assert(bits >= other_bits, "Can't assign values with a larger bit count than the target type.");
+
+            for (auto const i: std::views::iota(0uz, limb_count)) {
+                data_[i] = other.template limb_as<limb_type>(i);
+            }
+        }
+
+        [[nodiscard]] constexpr bigint(std::string_view const str) {
+            if (str.length() > 2 and str[0] == '0') {
+                switch (str[1]) {
+                    case 'x':
+                        init_from_string_base(str.substr(2), 16);
+                        break;
+                    case 'b':
+                        init_from_string_base(str.substr(2), 2);
+                        break;
+                    default:
+                        init_from_string_base(str.substr(1), 8);
+                        break;
+                }
+            } else {
+                if (str[0] == '-') {
+                    if constexpr (signedness == Signedness::Unsigned) {
+                        throw std::runtime_error("Cannot initialize an unsigned bigint23 with a negative value.");
+                    } else {
+                        init_from_string_base(str.substr(1), 10);
+                        *this = -*this;
+                    }
+                } else {
+                    init_from_string_base(str, 10);
+                }
+            }
+        }
+
+        template<std::size_t N>
+        [[nodiscard]] constexpr bigint(char const (&data)[N]) : bigint{std::string_view{data, N - 1}} {
+        }
+
+        [[nodiscard]] constexpr bigint(std::string const &str) : bigint{std::string_view{str}} {
+        }
+
+        template<std::integral T>
+        bigint constexpr &operator=(T const rhs) {
+            this->~bigint();
+            new(this) bigint(rhs);
+            return *this;
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        bigint constexpr &operator=(bigint<other_bits, other_signedness> const &rhs) {
+            if (this != std::addressof(rhs)) {
+                this->~bigint();
+                new(this) bigint(rhs);
+            }
+            return *this;
+        }
+
+        bigint constexpr &operator=(std::string_view const str) {
+            this->~bigint();
+            new(this) bigint(str);
+            return *this;
+        }
+
+        template<std::size_t N>
+        bigint constexpr &operator=(char const (&rhs)[N]) {
+            this->~bigint();
+            new(this) bigint(rhs);
+            return *this;
+        }
+
+        bigint constexpr &operator=(std::string const &rhs) {
+            this->~bigint();
+            new(this) bigint(rhs);
+            return *this;
+        }
+
+
+        template<std::integral T>
+        [[nodiscard]] constexpr std::strong_ordering operator<=>(T const other) const {
+            static_assert(std::to_underlying(bits) / CHAR_BIT >= sizeof(T),
+                          "Can't compare values with a larger bit count than the target type.");
+
+            auto const lhs_negative = std::is_signed_v<T> and is_negative();
+            auto const rhs_negative = detail::is_negative_value(other);
+            if (lhs_negative != rhs_negative) {
+                return lhs_negative ? std::strong_ordering::less : std::strong_ordering::greater;
+            }
+
+            // Above the limbs of other its sign extension is compared limb by limb, so only the low limbs need the
+            // value itself and no extended copy is built.
+            for (auto const i: std::views::reverse(std::views::iota(0uz, limb_count))) {
+                auto const limb = operand_limb(other, i);
+                if (data_[i] != limb) {
+                    return data_[i] < limb ? std::strong_ordering::less : std::strong_ordering::greater;
+                }
+            }
+            return std::strong_ordering::equal;
+        }
+
+        template<std::integral T>
+        [[nodiscard]] constexpr bool operator==(T const other) const {
+            static_assert(std::to_underlying(bits) / CHAR_BIT >= sizeof(T),
+                          "Can't compare values with a larger bit count than the target type.");
+            if constexpr (std::is_signed_v<T> and signedness == Signedness::Unsigned) {
+                if (other < 0) {
+                    return false;
+                }
+            }
+
+            for (auto const i: std::views::iota(0uz, limb_count)) {
+                if (data_[i] != operand_limb(other, i)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        [[nodiscard]] constexpr std::strong_ordering operator
+        <=>(bigint<other_bits, other_signedness> const &other) const {
+            auto const lhs_negative = is_negative();
+            auto const rhs_negative = other.is_negative();
+            if (lhs_negative != rhs_negative) {
+                return lhs_negative ? std::strong_ordering::less : std::strong_ordering::greater;
+            }
+
+            // With equal signs the two's complement limbs order the same way as unsigned values.
+            if constexpr (bits == other_bits) {
+                return detail::compare_limbs(data_, other.data_);
+            } else {
+                // Only the wider operand has limbs above the narrower one, there the sign limb of the narrower one
+                // stands in for its missing limbs.
+                using common_limb = detail::limb_for<std::max(std::to_underlying(bits), std::to_underlying(other_bits))>;
+                constexpr std::size_t max_size =
+                        std::max(std::to_underlying(bits), std::to_underlying(other_bits)) / (sizeof(common_limb) * CHAR_BIT);
+                for (auto const i: std::views::reverse(std::views::iota(0uz, max_size))) {
+                    auto const lhs = limb_as<common_limb>(i);
+                    auto const rhs = other.template limb_as<common_limb>(i);
+                    if (lhs != rhs) {
+                        return lhs < rhs ? std::strong_ordering::less : std::strong_ordering::greater;
+                    }
+                }
+                return std::strong_ordering::equal;
+            }
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        [[nodiscard]] constexpr bool operator==(bigint<other_bits, other_signedness> const &other) const {
+            if constexpr (bits < other_bits) {
+                return other == *this;
+            } else {
+                static_assert(bits >= other_bits, "Can't compare values with a larger bit count than the target type.");
+                if constexpr (other_signedness == Signedness::Signed and signedness == Signedness::Unsigned) {
+                    if (other.is_negative()) {
+                        return false;
+                    }
+                }
+
+                for (auto const i: std::views::iota(0uz, limb_count)) {
+                    if (data_[i] != other.template limb_as<limb_type>(i)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        }
+
+        template<std::integral T>
+        constexpr bigint &operator+=(T const other) {
+            static_assert(std::to_underlying(bits) / CHAR_BIT >= sizeof(T),
+                          "Can't assign values with a larger bit count than the target type.");
+            if constexpr (sizeof(T) > sizeof(std::uint64_t)) {
+                *this += bigint{other};
+            } else if (detail::is_negative_value(other)) {
+                detail::sub_word(data_, detail::word_magnitude(other));
+            } else {
+                detail::add_word(data_, detail::word_magnitude(other));
+            }
+            return *this;
+        }
+
+        template<std::integral T>
+        [[nodiscard]] constexpr bigint operator+(T const other) const {
+            auto result = bigint{*this};
+            result += other;
+            return result;
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        constexpr bigint &operator+=(bigint<other_bits, other_signedness> const &other) {
+            if constexpr (bits == other_bits) {
+                detail::add_limbs(data_, other.data_);
+            } else {
+                auto carry = limb_type{0};
+                for (auto const i: std::views::iota(0uz, limb_count)) {
+                    data_[i] = detail::add_carry(data_[i], other.template limb_as<limb_type>(i), carry, carry);
+                }
+            }
+            return *this;
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        [[nodiscard]] constexpr bigint operator+(bigint<other_bits, other_signedness> const &other) const {
+            auto result = bigint{*this};
+            result += other;
+            return result;
+        }
+
+        template<std::integral T>
+        constexpr bigint &operator*=(T const other) {
+            static_assert(std::to_underlying(bits) / CHAR_BIT >= sizeof(T),
+                          "Can't assign values with a larger bit count than the target type.");
+            if constexpr (sizeof(T) > sizeof(std::uint64_t)) {
+                *this *= bigint{other};
+            } else {
+                // Modulo 2^bits, x * -m is -(x * m), so a negative factor multiplies by its magnitude.
+                detail::multiply_word(data_, detail::word_magnitude(other));
+                if (detail::is_negative_value(other)) {
+                    negate();
+                }
+            }
+            return *this;
+        }
+
+        template<std::integral T>
+        [[nodiscard]] constexpr bigint operator*(T const other) const {
+            auto result = bigint{*this};
+            result *= other;
+            return result;
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        constexpr bigint &operator*=(bigint<other_bits, other_signedness> const &other) {
+            // The low bits of a two's complement product do not depend on the operand signs, so both operands are
+            // multiplied as sign extended magnitudes and the result is truncated to the width of this type.
+            if (static_cast<void const *>(&other) == this) {
+                *this = square(*this);
+                return *this;
+            }
+            auto const multiplier = bigint{other};
+            auto result = bigint{};
+            multiply_low(result.data_, data_, multiplier.data_);
+            *this = result;
+            return *this;
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        [[nodiscard]] constexpr bigint operator*(bigint<other_bits, other_signedness> const &other) const {
+            if (static_cast<void const *>(&other) == this) {
+                return square(*this);
+            }
+            auto result = bigint{*this};
+            result *= other;
+            return result;
+        }
+
+        template<std::integral T>
+        constexpr bigint &operator-=(T const other) {
+            static_assert(std::to_underlying(bits) / CHAR_BIT >= sizeof(T),
+                          "Can't assign values with a larger bit count than the target type.");
+            if constexpr (sizeof(T) > sizeof(std::uint64_t)) {
+                *this -= bigint{other};
+            } else if (detail::is_negative_value(other)) {
+                detail::add_word(data_, detail::word_magnitude(other));
+            } else {
+                detail::sub_word(data_, detail::word_magnitude(other));
+            }
+            return *this;
+        }
+
+        template<std::integral T>
+        [[nodiscard]] constexpr bigint operator-(T const other) const {
+            auto result = bigint{*this};
+            result -= other;
+            return result;
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        constexpr bigint &operator-=(bigint<other_bits, other_signedness> const &other) {
+            if constexpr (bits == other_bits) {
+                detail::sub_limbs(data_, other.data_);
+            } else {
+                auto borrow = limb_type{0};
+                for (auto const i: std::views::iota(0uz, limb_count)) {
+                    data_[i] = detail::sub_borrow(data_[i], other.template limb_as<limb_type>(i), borrow, borrow);
+                }
+            }
+            return *this;
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        [[nodiscard]] constexpr bigint operator-(bigint<other_bits, other_signedness> const &other) const {
+            auto result = bigint{*this};
+            result -= other;
+            return result;
+        }
+
+        template<std::integral T>
+        constexpr bigint &operator/=(T const other) {
+            if constexpr (is_short_divisor<T>) {
+                static_cast<void>(divide_by_word(other));
+            } else {
+                *this /= bigint{other};
+            }
+            return *this;
+        }
+
+        template<std::integral T>
+        [[nodiscard]] constexpr bigint operator/(T const other) const {
+            auto result = bigint{*this};
+            result /= other;
+            return result;
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        constexpr bigint &operator/=(bigint<other_bits, other_signedness> const &other) {
+            *this = divmod(*this, other).quotient;
+            return *this;
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        [[nodiscard]] constexpr bigint operator/(bigint<other_bits, other_signedness> const &other) const {
+            auto result = bigint{*this};
+            result /= other;
+            return result;
+        }
+
+        template<std::integral T>
+        constexpr bigint &operator%=(T const other) {
+            if constexpr (is_short_divisor<T>) {
+                auto const negative = is_negative();
+                auto const remainder = divide_by_word(other);
+                data_.fill(0);
+                data_[0] = remainder;
+                if (negative) {
+                    negate();
+                }
+            } else {
+                *this %= bigint{other};
+            }
+            return *this;
+        }
+
+        template<std::integral T>
+        [[nodiscard]] constexpr bigint operator%(T const other) const {
+            auto result = bigint{*this};
+            result %= other;
+            return result;
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        constexpr bigint &operator%=(bigint<other_bits, other_signedness> const &other) {
+            *this = divmod(*this, other).remainder;
+            return *this;
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        [[nodiscard]] constexpr bigint operator%(bigint<other_bits, other_signedness> const &other) const {
+            auto result = bigint{*this};
+            result %= other;
+            return result;
+        }
+
+        constexpr bigint &operator<<=(std::size_t const shift) {
+            if (shift >= std::to_underlying(bits)) {
+                data_.fill(0);
+            } else if (shift != 0) {
+                detail::shift_left_limbs(data_, shift);
+            }
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bigint operator<<(std::size_t const shift) const {
+            auto result = bigint{*this};
+            result <<= shift;
+            return result;
+        }
+
+        constexpr bigint &operator>>=(std::size_t const shift) {
+            if (shift >= std::to_underlying(bits)) {
+                data_.fill(sign_limb());
+            } else if (shift != 0) {
+                detail::shift_right_limbs(data_, shift, sign_limb());
+            }
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bigint operator>>(std::size_t const shift) const {
+            auto result = bigint{*this};
+            result >>= shift;
+            return result;
+        }
+
+        [[nodiscard]] constexpr bigint operator+() const {
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bigint operator-() const {
+            auto min_value = bigint{};
+            min_value.data_.back() = static_cast<limb_type>(limb_type{1} << (limb_bits - 1));
+
+            if (*this == min_value) {
+                throw std::overflow_error("Negation overflow: minimum value cannot be negated");
+            }
+
+            auto result = bigint{*this};
+            result.negate();
+            return result;
+        }
+
+        constexpr bigint &operator++() {
+            *this += 1;
+            return *this;
+        }
+
+        constexpr bigint operator++(int) {
+            auto result = bigint{*this};
+            ++*this;
+            return result;
+        }
+
+        constexpr bigint &operator--() {
+            *this -= 1;
+            return *this;
+        }
+
+        constexpr bigint operator--(int) {
+            auto result = bigint{*this};
+            --*this;
+            return result;
+        }
+
+        [[nodiscard]] constexpr bigint operator&(bigint const &other) const {
+            auto result = bigint{*this};
+            result &= other;
+            return result;
+        }
+
+        constexpr bigint &operator&=(bigint const &other) {
+            for (auto const i: std::views::iota(0uz, limb_count)) {
+                data_[i] &= other.data_[i];
+            }
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bigint operator|(bigint const &other) const {
+            auto result = bigint{*this};
+            result |= other;
+            return result;
+        }
+
+        constexpr bigint &operator|=(bigint const &other) {
+            for (auto const i: std::views::iota(0uz, limb_count)) {
+                data_[i] |= other.data_[i];
+            }
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bigint operator^(bigint const &other) const {
+            auto result = bigint{*this};
+            result ^= other;
+            return result;
+        }
+
+        constexpr bigint &operator^=(bigint const &other) {
+            for (auto const i: std::views::iota(0uz, limb_count)) {
+                data_[i] ^= other.data_[i];
+            }
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bigint operator~() const {
+            auto result = bigint{*this};
+            for (auto &limb: result.data_) {
+                limb = static_cast<limb_type>(~limb);
+            }
+            return result;
+        }
+
+        // Single bits of the two's complement representation, position 0 being the least significant bit. Each
+        // touches one limb; positions at or past the width throw std::out_of_range, as std::bitset::test does. The
+        // limb index comes from the range check, so no limb is indexed before it passed.
+        [[nodiscard]] constexpr bool test_bit(std::size_t const pos) const {
+            auto const limb = bit_limb(pos);
+            return (data_[limb] & bit_mask(pos)) != 0;
+        }
+
+        constexpr bigint &set_bit(std::size_t const pos) {
+            auto const limb = bit_limb(pos);
+            data_[limb] |= bit_mask(pos);
+            return *this;
+        }
+
+        constexpr bigint &clear_bit(std::size_t const pos) {
+            auto const limb = bit_limb(pos);
+            data_[limb] &= static_cast<limb_type>(~bit_mask(pos));
+            return *this;
+        }
+
+        constexpr bigint &flip_bit(std::size_t const pos) {
+            auto const limb = bit_limb(pos);
+            data_[limb] ^= bit_mask(pos);
+            return *this;
+        }
+
+        template<BitWidth other_bits, Signedness other_is_signed>
+        friend class bigint;
+
+        friend struct detail::limb_access;
+
+#ifndef bigint_DISABLE_IO
+        template<BitWidth other_bits, Signedness other_is_signed>
+        friend constexpr std::ostream &print_hex(std::ostream &, bigint<other_bits, other_is_signed> const &, bool);
+
+        template<BitWidth other_bits, Signedness other_is_signed>
+        friend constexpr std::ostream &print_oct(std::ostream &, bigint<other_bits, other_is_signed> const &);
+
+        template<BitWidth other_bits, Signedness other_is_signed>
+        friend constexpr std::ostream &print_dec(std::ostream &, bigint<other_bits, other_is_signed> const &);
+
+        template<BitWidth other_bits, Signedness other_is_signed>
+        friend constexpr std::ostream &operator<<(std::ostream &, bigint<other_bits, other_is_signed> const &);
+
+        template<BitWidth other_bits, Signedness other_is_signed>
+        friend constexpr std::istream &operator>>(std::istream &, bigint<other_bits, other_is_signed> &);
+#endif
+
+        template<BitWidth other_bits, Signedness other_is_signed>
+        friend constexpr std::to_chars_result to_chars(char *, char *, bigint<other_bits, other_is_signed> const &,
+                                                       int) noexcept;
+
+        template<BitWidth other_bits, Signedness other_is_signed>
+        friend constexpr std::from_chars_result from_chars(char const *, char const *,
+                                                           bigint<other_bits, other_is_signed> &, int) noexcept;
+
+        template<BitWidth other_bits, Signedness other_is_signed>
+        friend constexpr bigint<other_bits, other_is_signed> byteswap(bigint<other_bits, other_is_signed> const &);
+
+        template<BitWidth other_bits, Signedness other_is_signed>
+        friend constexpr bigint<other_bits, other_is_signed> square(bigint<other_bits, other_is_signed> const &);
+
+        template<BitWidth a_bits, Signedness a_is_signed, BitWidth b_bits, Signedness b_is_signed>
+        friend constexpr detail::widening_product<a_bits, a_is_signed, b_bits, b_is_signed>
+        widening_mul(bigint<a_bits, a_is_signed> const &, bigint<b_bits, b_is_signed> const &);
+
+        template<BitWidth other_bits, Signedness other_is_signed>
+        friend constexpr bigint<other_bits, other_is_signed> mul_hi(bigint<other_bits, other_is_signed> const &,
+                                                                    bigint<other_bits, other_is_signed> const &);
+
+        template<BitWidth dividend_bits, Signedness dividend_is_signed, BitWidth divisor_bits, Signedness divisor_is_signed>
+        friend constexpr divmod_result<bigint<dividend_bits, dividend_is_signed> >
+        divmod(bigint<dividend_bits, dividend_is_signed> const &, bigint<divisor_bits, divisor_is_signed> const &);
+
+        template<BitWidth other_bits, Signedness other_is_signed, std::integral T>
+        friend constexpr divmod_result<bigint<other_bits, other_is_signed> >
+        divmod(bigint<other_bits, other_is_signed> const &, T);
+
+    private:
+        // result = low limb_count limbs of a * b. Passing the same array twice selects the squaring kernels.
+        static constexpr void multiply_low(std::array<limb_type, limb_count> &result,
+                                           std::array<limb_type, limb_count> const &a,
+                                           std::array<limb_type, limb_count> const &b) {
+            constexpr auto &thresholds = detail::default_multiply_thresholds;
+            constexpr auto scratch_size = detail::multiply_low_scratch(limb_count, thresholds);
+            if constexpr (detail::use_ntt<limb_type>(limb_count)) {
+                detail::multiply_ntt(result.data(), a.data(), b.data(), limb_count, limb_count);
+            } else if constexpr (scratch_size == 0) {
+                if (&a == &b) {
+                    detail::square_low_basecase(result.data(), a.data(), limb_count);
+                } else {
+                    detail::multiply_low_basecase(result.data(), a.data(), b.data(), limb_count);
+                }
+            } else {
+                std::array<limb_type, scratch_size> scratch;
+                detail::multiply_low(result.data(), a.data(), b.data(), limb_count, scratch.data(), thresholds);
+            }
+        }
+
+        [[nodiscard]] constexpr bool is_negative() const {
+            if constexpr (signedness == Signedness::Signed) {
+                return (data_.back() >> (limb_bits - 1)) != 0;
+            } else {
+                return false;
+            }
+        }
+
+        [[nodiscard]] constexpr limb_type sign_limb() const {
+            return is_negative() ? static_cast<limb_type>(~limb_type{0}) : limb_type{0};
+        }
+
+        // Returns the index-th limb of the value reinterpreted as limbs of type L, sign extended past the top.
+        template<std::unsigned_integral L>
+        [[nodiscard]] constexpr L limb_as(std::size_t const index) const {
+            if constexpr (sizeof(L) == sizeof(limb_type)) {
+                return index < limb_count ? data_[index] : sign_limb();
+            } else if constexpr (sizeof(L) > sizeof(limb_type)) {
+                constexpr auto ratio = std::size_t{sizeof(L) / sizeof(limb_type)};
+                auto result = L{0};
+                for (auto const k: std::views::iota(0uz, ratio)) {
+                    auto const source = std::size_t{index * ratio + k};
+                    auto const part = source < limb_count ? data_[source] : sign_limb();
+                    result |= static_cast<L>(static_cast<L>(part) << (k * limb_bits));
+                }
+                return result;
+            } else {
+                constexpr auto ratio = std::size_t{sizeof(limb_type) / sizeof(L)};
+                auto const source = std::size_t{index / ratio};
+                if (source >= limb_count) {
+                    return static_cast<L>(sign_limb());
+                }
+                return static_cast<L>(data_[source] >> ((index % ratio) * sizeof(L) * CHAR_BIT));
+            }
+        }
+
+        [[nodiscard]] constexpr bigint<bits, Signedness::Unsigned> magnitude() const {
+            auto result = bigint<bits, Signedness::Unsigned>{};
+            result.data_ = data_;
+            if (is_negative()) {
+                result.negate();
+            }
+            return result;
+        }
+
+        // Divides |*this| by |divisor|. A divisor wider than this type is truncated once it is known to be smaller
+        // than the dividend, so the limb kernel always works on arrays of this type's size.
+        template<BitWidth other_bits, Signedness other_signedness>
+        constexpr void divide_magnitudes(bigint<other_bits, other_signedness> const &divisor,
+                                         bigint<bits, Signedness::Unsigned> &quotient,
+                                         bigint<bits, Signedness::Unsigned> &remainder) const {
+            auto const dividend = magnitude();
+            auto const divisor_magnitude = divisor.magnitude();
+            if constexpr (other_bits > bits) {
+                if (divisor_magnitude > dividend) {
+                    quotient = std::uint8_t{0};
+                    remainder = dividend;
+                    return;
+                }
+            }
+
+            auto divisor_limbs = std::array<limb_type, limb_count>{};
+            for (auto const i: std::views::iota(0uz, limb_count)) {
+                divisor_limbs[i] = divisor_magnitude.template limb_as<limb_type>(i);
+            }
+            detail::divide_limbs(dividend.data_, divisor_limbs, quotient.data_, remainder.data_);
+        }
+
+        constexpr void negate() {
+            auto carry = limb_type{1};
+            for (auto &limb: data_) {
+                limb = static_cast<limb_type>(static_cast<limb_type>(~limb) + carry);
+                carry = static_cast<limb_type>(carry and limb == 0);
+            }
+        }
+
+        // The index of the limb holding bit pos; throws std::out_of_range for positions at or past the width.
+        [[nodiscard]] static constexpr std::size_t bit_limb(std::size_t const pos) {
+            if (pos >= std::to_underlying(bits)) {
+                throw std::out_of_range("Bit position out of range.");
+            }
+            return pos / limb_bits;
+        }
+
+        [[nodiscard]] static constexpr limb_type bit_mask(std::size_t const pos) noexcept {
+            return static_cast<limb_type>(limb_type{1} << (pos % limb_bits));
+        }
+
+        constexpr void init_from_string_base(std::string_view const str, std::uint32_t const base) {
+            data_.fill(0);
+            switch (detail::parse_digits(data_, str.data(), str.data() + str.size(), static_cast<std::uint8_t>(base), true)) {
+                case detail::parse_status::ok:
+                    return;
+                case detail::parse_status::overflow:
+                    throw std::overflow_error("Overflow during string conversion");
+                case detail::parse_status::invalid_digit:
+                    break;
+            }
+            for (auto const c: str) {
+                if (c != '\'' and c != ' ' and detail::digit_value(c) >= 16) {
+                    throw std::runtime_error("Invalid digit in input string.");
+                }
+            }
+            throw std::runtime_error("Digit out of range for base.");
+        }
+
+        // Limb i of bigint{value}, computed on the fly for the mixed operators.
+        template<std::integral T>
+        [[nodiscard]] static constexpr limb_type operand_limb(T const value, std::size_t const i) noexcept {
+            using wide_type = std::conditional_t<std::is_signed_v<T>, std::intmax_t, std::uintmax_t>;
+            constexpr auto value_limbs = std::min(limb_count, sizeof(std::uintmax_t) / sizeof(limb_type));
+            if (i >= value_limbs) {
+                return detail::is_negative_value(value) ? static_cast<limb_type>(~limb_type{0}) : limb_type{0};
+            }
+            return static_cast<limb_type>(static_cast<std::uintmax_t>(static_cast<wide_type>(value)) >> (i * limb_bits));
+        }
+
+        // Integral divisors whose value as a bigint of this type fits one limb, so operator/= and operator%= can use
+        // short division. Negative divisors of an unsigned type and unsigned divisors that would wrap to negative
+        // values of a signed type of the same width keep going through divmod.
+        template<std::integral T>
+        static constexpr bool is_short_divisor = sizeof(T) <= sizeof(limb_type) and
+                                                 (std::is_signed_v<T>
+                                                      ? signedness == Signedness::Signed
+                                                      : signedness == Signedness::Unsigned or
+                                                        sizeof(T) * CHAR_BIT < std::to_underlying(bits));
+
+        // Replaces this with the quotient of a short division truncated towards zero and returns the magnitude of
+        // the remainder.
+        template<std::integral T>
+        constexpr limb_type divide_by_word(T const divisor) {
+            if (divisor == 0) {
+                throw std::overflow_error("Division by zero");
+            }
+            auto const negative = is_negative();
+            if (negative) {
+                negate();
+            }
+            auto const remainder = detail::short_divide(data_, static_cast<limb_type>(detail::word_magnitude(divisor)));
+            if (negative != detail::is_negative_value(divisor)) {
+                negate();
+            }
+            return remainder;
+        }
+    };
+
+    // Computes quotient and remainder of a single division. The quotient truncates towards zero and the remainder
+    // takes the sign of the dividend, matching operator/ and operator%.
+    template<BitWidth bits, Signedness signedness, BitWidth other_bits, Signedness other_signedness>
+    constexpr divmod_result<bigint<bits, signedness> > divmod(bigint<bits, signedness> const &dividend,
+                                                               bigint<other_bits, other_signedness> const &divisor) {
+        if (divisor == std::int8_t{0}) {
+            throw std::overflow_error("Division by zero");
+        }
+
+        auto quotient = bigint<bits, Signedness::Unsigned>{};
+        auto remainder = bigint<bits, Signedness::Unsigned>{};
+        dividend.divide_magnitudes(divisor, quotient, remainder);
+        if (dividend.is_negative() != divisor.is_negative()) {
+            quotient.negate();
+        }
+        if (dividend.is_negative()) {
+            remainder.negate();
+        }
+        return {bigint<bits, signedness>{quotient}, bigint<bits, signedness>{remainder}};
+    }
+
+    // divmod by a built-in integer. Divisors that fit a single limb take short division as in operator/=, all
+    // others are converted and go through the general divmod. The remainder takes the sign of the dividend.
+    template<BitWidth bits, Signedness signedness, std::integral T>
+    constexpr divmod_result<bigint<bits, signedness> > divmod(bigint<bits, signedness> const &dividend,
+                                                               T const divisor) {
+        using value_type = bigint<bits, signedness>;
+        if constexpr (value_type::template is_short_divisor<T>) {
+            auto quotient = dividend;
+            auto remainder = value_type{};
+            remainder.data_[0] = quotient.divide_by_word(divisor);
+            if (dividend.is_negative()) {
+                remainder.negate();
+            }
+            return {quotient, remainder};
+        } else {
+            return divmod(dividend, value_type{divisor});
+        }
+    }
+
+    namespace detail {
+        // Read and write access to the limbs of a bigint for the kernels in this namespace.
+        struct limb_access {
+            template<BitWidth bits, Signedness signedness>
+            [[nodiscard]] static constexpr auto &limbs(bigint<bits, signedness> &value) noexcept {
+                return value.data_;
+            }
+
+            template<BitWidth bits, Signedness signedness>
+            [[nodiscard]] static constexpr auto const &limbs(bigint<bits, signedness> const &value) noexcept {
+                return value.data_;
+            }
+
+            // The low bits of value in target_type, without the width check of the converting constructor.
+            template<typename target_type, BitWidth bits, Signedness signedness>
+            [[nodiscard]] static constexpr target_type truncate(bigint<bits, signedness> const &value) noexcept {
+                auto result = target_type{};
+                for (auto const i: std::views::iota(0uz, target_type::limb_count)) {
+                    result.data_[i] = value.template limb_as<typename target_type::limb_type>(i);
+                }
+                return result;
+            }
+        };
+
+        // Largest power of ten that fits a limb, used to peel off that many decimal digits per short division.
+        template<std::unsigned_integral limb_type>
+        struct decimal_chunk {
+            static constexpr std::size_t digits = std::numeric_limits<limb_type>::digits10;
+            static constexpr limb_divisor<limb_type> divisor{
+                [] {
+                    auto result = limb_type{1};
+                    for (auto i = 0uz; i < digits; ++i) {
+                        result = static_cast<limb_type>(result * 10);
+                    }
+                    return result;
+                }()
+            };
+        };
+
+        // The number of decimal digits of 2^bits - 1, the largest value of the width, i.e. its ilog10 plus one. That
+        // is floor(bits log10(2)) + 1, computed with log10(2) bracketed by two neighbouring 64 bit fractions; both
+        // brackets have to give the same floor, so the count is exact rather than an estimate.
+        template<BitWidth bits>
+        inline constexpr std::size_t max_decimal_digits = [] {
+            constexpr auto log10_2 = std::uint64_t{0x4D104D427DE7FBCCULL}; // floor(log10(2) 2^64)
+            constexpr auto width = static_cast<std::uint64_t>(std::to_underlying(bits));
+            constexpr auto lower = mul_wide(width, log10_2).high;
+            static_assert(lower == mul_wide(width, log10_2 + 1).high, "Width too large for an exact digit count.");
+            return static_cast<std::size_t>(lower) + 1;
+        }();
+
+        // Room for the decimal digits of any value of the width. Leaf conversions write whole chunks of digits before
+        // stripping leading zeros, so the digit count is rounded up to a multiple of the chunk size.
+        template<BitWidth bits>
+        inline constexpr std::size_t decimal_buffer_size = [] {
+            constexpr auto chunk_digits = decimal_chunk<limb_for<std::to_underlying(bits)> >::digits;
+            return (max_decimal_digits<bits> + chunk_digits - 1) / chunk_digits * chunk_digits;
+        }();
+
+        inline constexpr std::array<char, 200> decimal_pairs = [] {
+            auto result = std::array<char, 200>{};
+            for (auto i = 0uz; i < 100; ++i) {
+                result[2 * i] = static_cast<char>('0' + i / 10);
+                result[2 * i + 1] = static_cast<char>('0' + i % 10);
+            }
+            return result;
+        }();
+
+        // Writes exactly count digits of value so that they end at last, returns the first written position.
+        template<std::unsigned_integral limb_type>
+        constexpr char *write_padded_decimal(char *last, limb_type value, std::size_t count) noexcept {
+            auto first = last;
+            for (; count >= 2; count -= 2) {
+                auto const pair = static_cast<std::size_t>(value % 100) * 2;
+                value = static_cast<limb_type>(value / 100);
+                *--first = decimal_pairs[pair + 1];
+                *--first = decimal_pairs[pair];
+            }
+            if (count != 0) {
+                *--first = static_cast<char>('0' + value % 10);
+            }
+            return first;
+        }
+
+        // Values with more than this many chunks of digits are split by powers of ten before the chunked short
+        // division takes over.
+        inline constexpr std::size_t decimal_leaf_chunks = 32;
+
+        // power[k] holds decimal_chunk^(2^k) for every k where that power still fits the width.
+        template<BitWidth bits>
+        struct decimal_powers {
+            using value_type = bigint<bits, Signedness::Unsigned>;
+            static constexpr std::size_t capacity = std::bit_width(value_type::limb_count) + 1;
+
+            std::array<value_type, capacity> power{};
+            std::array<std::size_t, capacity> digits{};
+            std::size_t count{};
+        };
+
+        template<BitWidth bits>
+        constexpr decimal_powers<bits> make_decimal_powers() {
+            using value_type = bigint<bits, Signedness::Unsigned>;
+            using chunk = decimal_chunk<typename value_type::limb_type>;
+            auto result = decimal_powers<bits>{};
+            result.power[0] = chunk::divisor.divisor;
+            result.digits[0] = chunk::digits;
+            result.count = 1;
+            auto const max_value = ~value_type{};
+            while (result.count < result.capacity and
+                   result.power[result.count - 1] <= max_value / result.power[result.count - 1]) {
+                result.power[result.count] = result.power[result.count - 1] * result.power[result.count - 1];
+                result.digits[result.count] = result.digits[result.count - 1] * 2;
+                ++result.count;
+            }
+            return result;
+        }
+
+        template<BitWidth bits>
+        decimal_powers<bits> const &cached_decimal_powers() {
+            static auto const table = make_decimal_powers<bits>();
+            return table;
+        }
+
+        // Chunked short division: every step divides by decimal_chunk and emits all of its digits at once. A
+        // non-zero min_digits pads the output with leading zeros, otherwise leading zeros are dropped.
+        template<BitWidth bits>
+        constexpr char *write_decimal_chunks(char *last, bigint<bits, Signedness::Unsigned> const &value,
+                                             std::size_t const min_digits) {
+            using chunk = decimal_chunk<typename bigint<bits, Signedness::Unsigned>::limb_type>;
+            auto limbs = limb_access::limbs(value);
+            auto size = limbs.size();
+            while (size > 0 and limbs[size - 1] == 0) {
+                --size;
+            }
+
+            auto first = last;
+            while (size > 0) {
+                first = write_padded_decimal(first, short_divide(limbs.data(), size, chunk::divisor), chunk::digits);
+                if (limbs[size - 1] == 0) {
+                    --size;
+                }
+            }
+            if (min_digits != 0) {
+                while (static_cast<std::size_t>(last - first) < min_digits) {
+                    *--first = '0';
+                }
+            } else {
+                while (first != last and *first == '0') {
+                    ++first;
+                }
+            }
+            return first;
+        }
+
+        // Divide and conquer: value < power[level]^2 is split into value / power[level] and value % power[level],
+        // the lower half always taking exactly digits[level] characters. Without padding the level first drops to the
+        // largest power not above value, so the high half is never zero and no digits are written past the value's
+        // own, rounded up to a whole chunk.
+        template<BitWidth bits>
+        constexpr char *write_decimal_split(char *last, bigint<bits, Signedness::Unsigned> const &value,
+                                            decimal_powers<bits> const &powers, std::size_t level,
+                                            std::size_t const min_digits) {
+            if (min_digits == 0) {
+                while (level > 0 and value < powers.power[level]) {
+                    --level;
+                }
+            }
+            if ((std::size_t{2} << level) <= decimal_leaf_chunks) {
+                return write_decimal_chunks(last, value, min_digits);
+            }
+
+            auto const [high, low] = divmod(value, powers.power[level]);
+            auto const first = write_decimal_split(last, low, powers, level - 1, powers.digits[level]);
+            auto const high_digits = min_digits > powers.digits[level] ? min_digits - powers.digits[level] : 0;
+            return write_decimal_split(first, high, powers, level - 1, high_digits);
+        }
+
+        // Writes the decimal digits of value so that they end at last and returns the position of the first one.
+        template<BitWidth bits>
+        constexpr char *write_decimal(char *last, bigint<bits, Signedness::Unsigned> const &value) {
+            if (value == std::uint8_t{0}) {
+                *--last = '0';
+                return last;
+            }
+            using chunk = decimal_chunk<typename bigint<bits, Signedness::Unsigned>::limb_type>;
+            constexpr auto max_chunks = std::size_t{decimal_buffer_size<bits> / chunk::digits};
+            if constexpr (max_chunks <= decimal_leaf_chunks) {
+                return write_decimal_chunks(last, value, 0);
+            } else {
+                if consteval {
+                    auto const powers = make_decimal_powers<bits>();
+                    return write_decimal_split(last, value, powers, powers.count - 1, 0);
+                } else {
+                    auto const &powers = cached_decimal_powers<bits>();
+                    return write_decimal_split(last, value, powers, powers.count - 1, 0);
+                }
+            }
+        }
+    }
+
+    namespace detail {
+        inline constexpr std::string_view digit_chars = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+        // Two hexadecimal characters for every byte value.
+        template<bool uppercase>
+        inline constexpr std::array<char, 512> hex_pairs = [] {
+            constexpr auto digits = uppercase ? std::string_view{"0123456789ABCDEF"} : digit_chars;
+            auto result = std::array<char, 512>{};
+            for (auto i = 0uz; i < 256; ++i) {
+                result[2 * i] = digits[i >> 4];
+                result[2 * i + 1] = digits[i & 0xF];
+            }
+            return result;
+        }();
+
+        // Writes the lowest digits hexadecimal digits of limbs so that they end at last, a byte per table lookup.
+        template<std::unsigned_integral limb_type, std::size_t size>
+        constexpr char *write_hex(char *last, std::array<limb_type, size> const &limbs, std::size_t const digits,
+                                  bool const uppercase) noexcept {
+            auto const &table = uppercase ? hex_pairs<true> : hex_pairs<false>;
+            auto const byte_at = [&limbs](std::size_t const i) {
+                return static_cast<std::uint8_t>(limbs[i / sizeof(limb_type)] >> (i % sizeof(limb_type) * CHAR_BIT));
+            };
+            for (auto i = 0uz; i < digits / 2; ++i) {
+                auto const pair = std::size_t{byte_at(i)} * 2;
+                *--last = table[pair + 1];
+                *--last = table[pair];
+            }
+            if (digits % 2 != 0) {
+                *--last = table[std::size_t{byte_at(digits / 2)} * 2 + 1];
+            }
+            return last;
+        }
+
+        // Writes the lowest digits digits of limbs in base 2^shift so that they end at last, returns the first
+        // written position.
+        template<std::unsigned_integral limb_type, std::size_t size>
+        constexpr char *write_power_of_two(char *last, std::array<limb_type, size> const &limbs,
+                                           std::size_t const shift, std::size_t const digits) noexcept {
+            constexpr auto limb_bits = std::size_t{sizeof(limb_type) * CHAR_BIT};
+            if (shift == 4) {
+                return write_hex(last, limbs, digits, false);
+            }
+            auto const mask = static_cast<limb_type>((limb_type{1} << shift) - 1);
+            for (auto i = 0uz; i < digits; ++i) {
+                auto const index = i * shift / limb_bits;
+                auto const offset = i * shift % limb_bits;
+                auto digit = static_cast<limb_type>(limbs[index] >> offset);
+                if (offset + shift > limb_bits and index + 1 < size) {
+                    digit |= static_cast<limb_type>(limbs[index + 1] << (limb_bits - offset));
+                }
+                *--last = digit_chars[digit & mask];
+            }
+            return last;
+        }
+
+        // Number of significant bits in limbs, at least one so that zero still gets a digit.
+        template<std::unsigned_integral limb_type, std::size_t size>
+        [[nodiscard]] constexpr std::size_t significant_bits(std::array<limb_type, size> const &limbs) noexcept {
+            auto top = size;
+            while (top > 0 and limbs[top - 1] == 0) {
+                --top;
+            }
+            return top == 0 ? std::size_t{1} : (top - 1) * sizeof(limb_type) * CHAR_BIT + std::bit_width(limbs[top - 1]);
+        }
+
+        // Writes the digits of value in any base by repeated short division by radix_chunk.
+        template<BitWidth bits>
+        constexpr char *write_radix(char *last, bigint<bits, Signedness::Unsigned> const &value,
+                                    std::uint8_t const base) noexcept {
+            using limb_type = typename bigint<bits, Signedness::Unsigned>::limb_type;
+            auto const chunk = radix_chunk<limb_type>{base};
+            auto const divisor = limb_divisor<limb_type>{chunk.power};
+            auto limbs = limb_access::limbs(value);
+            auto size = limbs.size();
+            while (size > 0 and limbs[size - 1] == 0) {
+                --size;
+            }
+
+            auto first = last;
+            while (size > 0) {
+                auto rest = short_divide(limbs.data(), size, divisor);
+                if (limbs[size - 1] == 0) {
+                    --size;
+                }
+                // Lower chunks keep their leading zeros, the top one stops after its last non-zero digit.
+                for (auto i = 0uz; i < chunk.digits and (size > 0 or rest != 0); ++i) {
+                    *--first = digit_chars[rest % base];
+                    rest = static_cast<limb_type>(rest / base);
+                }
+            }
+            if (first == last) {
+                *--first = '0';
+            }
+            return first;
+        }
+    }
+
+    // Writes value in base 2 to 36 like std::to_chars: lowercase digits, no prefix and a leading '-' for negative
+    // signed values. Returns {last, std::errc::value_too_large} when the range is too small.
+    template<BitWidth bits, Signedness signedness>
+    constexpr std::to_chars_result to_chars(char *first, char *last, bigint<bits, signedness> const &value,
+                                            int const base = 10) noexcept {
+        if (base < 2 or base > 36) {
+            return {last, std::errc::invalid_argument};
+        }
+        auto const negative = value.is_negative();
+        if (negative) {
+            if (first == last) {
+                return {last, std::errc::value_too_large};
+            }
+            *first++ = '-';
+        }
+        auto const magnitude = value.magnitude();
+
+        if (std::has_single_bit(static_cast<unsigned>(base))) {
+            auto const &limbs = magnitude.data_;
+            auto const shift = static_cast<std::size_t>(std::countr_zero(static_cast<unsigned>(base)));
+            auto const digits = (detail::significant_bits(limbs) + shift - 1) / shift;
+            if (static_cast<std::size_t>(last - first) < digits) {
+                return {last, std::errc::value_too_large};
+            }
+            detail::write_power_of_two(first + digits, limbs, shift, digits);
+            return {first + digits, std::errc{}};
+        }
+
+        // Base 3 needs the most digits of all bases that take this path, decimal output rounds up to whole chunks.
+        constexpr auto max_digits = std::max(std::size_t{std::to_underlying(bits) * 2 / 3 + 2},
+                                             detail::decimal_buffer_size<bits>);
+        auto buffer = std::array<char, max_digits>{};
+        auto const end = buffer.data() + buffer.size();
+        auto const begin = base == 10
+                               ? detail::write_decimal(end, magnitude)
+                               : detail::write_radix(end, magnitude, static_cast<std::uint8_t>(base));
+        if (last - first < end - begin) {
+            return {last, std::errc::value_too_large};
+        }
+        return {std::ranges::copy(begin, end, first).out, std::errc{}};
+    }
+
+    // Parses value in base 2 to 36 like std::from_chars: no prefix, no whitespace and a leading '-' only for signed
+    // types. value is left untouched unless the result reports success.
+    template<BitWidth bits, Signedness signedness>
+    constexpr std::from_chars_result from_chars(char const *first, char const *last, bigint<bits, signedness> &value,
+                                                int const base = 10) noexcept {
+        if (base < 2 or base > 36) {
+            return {first, std::errc::invalid_argument};
+        }
+
+        auto pos = first;
+        auto negative = false;
+        if constexpr (signedness == Signedness::Signed) {
+            if (pos != last and *pos == '-') {
+                negative = true;
+                ++pos;
+            }
+        }
+        auto const digits_begin = pos;
+        while (pos != last and detail::digit_value(*pos) < base) {
+            ++pos;
+        }
+        if (pos == digits_begin) {
+            return {first, std::errc::invalid_argument};
+        }
+
+        auto result = bigint<bits, Signedness::Unsigned>{};
+        auto overflow = detail::parse_digits(result.data_, digits_begin, pos, static_cast<std::uint8_t>(base), false) !=
+                        detail::parse_status::ok;
+
+        if constexpr (signedness == Signedness::Signed) {
+            if (not overflow and (result.data_.back() >> (result.limb_bits - 1)) != 0) {
+                // Only the most negative value has its top bit set and still fits.
+                auto const minimum = bigint<bits, Signedness::Unsigned>{std::uint8_t{1}} << (std::to_underlying(bits) - 1);
+                overflow = not negative or result != minimum;
+            }
+        }
+        if (overflow) {
+            return {pos, std::errc::result_out_of_range};
+        }
+
+        value.data_ = result.data_;
+        if (negative) {
+            value.negate();
+        }
+        return {pos, std::errc{}};
+    }
 
 #ifndef bigint_DISABLE_IO
-        template<BitWidth other_bits, Signedness other_is_signed>
-        friend constexpr std::ostream &print_hex(std::ostream &, bigint<other_bits, other_is_signed> const &, bool);
+    // Prints the two's complement bytes without leading zero bytes, so the output always has an even digit count.
+    // Like the standard integer output, zero gets no base prefix.
+    template<BitWidth bits, Signedness signedness>
+    constexpr std::ostream &print_hex(std::ostream &os, bigint<bits, signedness> const &data, bool const use_uppercase) {
+        auto const bytes = (detail::significant_bits(data.data_) + CHAR_BIT - 1) / CHAR_BIT;
+
+        constexpr auto max_hex_digits = std::size_t{std::to_underlying(bits) / 4 + 2};
+        auto buffer = std::array<char, max_hex_digits>{};
+        auto const last = buffer.data() + buffer.size();
+        auto pos = detail::write_hex(last, data.data_, bytes * 2, use_uppercase);
+        if ((os.flags() & std::ios_base::showbase) != 0 and data != std::uint8_t{0}) {
+            *--pos = use_uppercase ? 'X' : 'x';
+            *--pos = '0';
+        }
+
+        os.write(pos, last - pos);
+        return os;
+    }
+
+    // Prints the two's complement bits, so negative values come out as their unsigned counterpart.
+    template<BitWidth bits, Signedness signedness>
+    constexpr std::ostream &print_oct(std::ostream &os, bigint<bits, signedness> const &data) {
+        auto const digits = (detail::significant_bits(data.data_) + 2) / 3;
+
+        constexpr auto max_oct_digits = std::size_t{(std::to_underlying(bits) / 3) + 2};
+        auto buffer = std::array<char, max_oct_digits>{};
+        auto const last = buffer.data() + buffer.size();
+        auto pos = detail::write_power_of_two(last, data.data_, 3, digits);
+        if ((os.flags() & std::ios_base::showbase) != 0 and *pos != '0') {
+            *--pos = '0';
+        }
+
+        os.write(pos, last - pos);
+        return os;
+    }
+
+    template<BitWidth bits, Signedness signedness>
+    constexpr std::ostream &print_dec(std::ostream &os, bigint<bits, signedness> const &data) {
+        auto const negative = data.is_negative();
+        auto const temp = data.magnitude();
+
+        auto buffer = std::array<char, detail::decimal_buffer_size<bits> >{};
+        auto const last = buffer.data() + buffer.size();
+        auto const pos = detail::write_decimal(last, temp);
+
+        if (negative) {
+            os.put('-');
+        }
+
+        os.write(pos, last - pos);
+        return os;
+    }
+
+    template<BitWidth bits, Signedness signedness>
+    constexpr std::ostream &operator<<(std::ostream &os, bigint<bits, signedness> const &data) {
+        auto const flags = os.flags();
+        auto const base_flag = flags & std::ios_base::basefield;
+        auto const use_uppercase = (flags & std::ios_base::uppercase) != 0;
+
+        switch (base_flag) {
+            case std::ios_base::hex:
+                print_hex(os, data, use_uppercase);
+                break;
+            case std::ios_base::oct:
+                print_oct(os, data);
+                break;
+            case std::ios_base::dec:
+            default:
+                print_dec(os, data);
+                break;
+        }
+
+        return os;
+    }
+
+    template<BitWidth bits, Signedness signedness>
+    constexpr std::istream &operator>>(std::istream &is, bigint<bits, signedness> &data) {
+        auto token = std::string{};
+        if (!(is >> token)) {
+            return is;
+        }
+
+        auto const flags = is.flags();
+        auto const base_flag = flags & std::ios_base::basefield;
+        auto base = std::uint8_t{10};
+        if (base_flag == std::ios_base::hex) {
+            base = 16;
+        } else if (base_flag == std::ios_base::oct) {
+            base = 8;
+        }
+        try {
+            if (base != 10) {
+                if (!token.empty() and token[0] == '-') {
+                    throw std::runtime_error("Negative sign not allowed for non-decimal input");
+                }
+                data = bigint<bits, signedness>();
+                data.init_from_string_base(token, base);
+            } else {
+                data = token;
+            }
+        } catch (std::exception const &) {
+            is.setstate(std::ios::failbit);
+        }
+        return is;
+    }
+#endif
+
+    template<BitWidth bits, Signedness signedness>
+    constexpr bigint<bits, signedness> byteswap(bigint<bits, signedness> const &data) {
+        auto result = bigint<bits, signedness>{data};
+        std::ranges::reverse(result.data_);
+        for (auto &limb: result.data_) {
+            limb = std::byteswap(limb);
+        }
+        return result;
+    }
+
+    // Rotates the bits of data as an unsigned value of the full width, like std::rotl; a negative shift rotates
+    // right.
+    template<BitWidth bits, Signedness signedness>
+    [[nodiscard]] constexpr bigint<bits, signedness> rotl(bigint<bits, signedness> const &data, int const shift) {
+        auto result = data;
+        if (auto const left = detail::rotate_amount(shift, std::to_underlying(bits)); left != 0) {
+            detail::rotate_left_limbs(detail::limb_access::limbs(result), left);
+        }
+        return result;
+    }
+
+    template<BitWidth bits, Signedness signedness>
+    [[nodiscard]] constexpr bigint<bits, signedness> rotr(bigint<bits, signedness> const &data, int const shift) {
+        auto result = data;
+        if (auto const left = detail::rotate_amount(-static_cast<long long>(shift), std::to_underlying(bits));
+            left != 0) {
+            detail::rotate_left_limbs(detail::limb_access::limbs(result), left);
+        }
+        return result;
+    }
+
+    // The functions of <bit> for unsigned bigints. They go over the limbs with the limb versions, which compile to
+    // lzcnt, tzcnt and popcnt where the target has them, and the counting ones stop at the first non-zero limb.
+    template<BitWidth bits>
+    [[nodiscard]] constexpr int countl_zero(bigint<bits, Signedness::Unsigned> const &data) noexcept {
+        auto const &limbs = detail::limb_access::limbs(data);
+        using limb_type = std::remove_cvref_t<decltype(limbs[0])>;
+        auto zeros = 0;
+        for (auto const limb: std::views::reverse(limbs)) {
+            if (limb != 0) {
+                return zeros + std::countl_zero(limb);
+            }
+            zeros += std::numeric_limits<limb_type>::digits;
+        }
+        return zeros;
+    }
+
+    template<BitWidth bits>
+    [[nodiscard]] constexpr int countr_zero(bigint<bits, Signedness::Unsigned> const &data) noexcept {
+        auto const &limbs = detail::limb_access::limbs(data);
+        using limb_type = std::remove_cvref_t<decltype(limbs[0])>;
+        auto zeros = 0;
+        for (auto const limb: limbs) {
+            if (limb != 0) {
+                return zeros + std::countr_zero(limb);
+            }
+            zeros += std::numeric_limits<limb_type>::digits;
+        }
+        return zeros;
+    }
+
+    template<BitWidth bits>
+    [[nodiscard]] constexpr int countl_one(bigint<bits, Signedness::Unsigned> const &data) noexcept {
+        return countl_zero(~data);
+    }
+
+    template<BitWidth bits>
+    [[nodiscard]] constexpr int countr_one(bigint<bits, Signedness::Unsigned> const &data) noexcept {
+        return countr_zero(~data);
+    }
+
+    template<BitWidth bits>
+    [[nodiscard]] constexpr int popcount(bigint<bits, Signedness::Unsigned> const &data) noexcept {
+        auto count = 0;
+        for (auto const limb: detail::limb_access::limbs(data)) {
+            count += std::popcount(limb);
+        }
+        return count;
+    }
+
+    template<BitWidth bits>
+    [[nodiscard]] constexpr int bit_width(bigint<bits, Signedness::Unsigned> const &data) noexcept {
+        return static_cast<int>(std::to_underlying(bits)) - countl_zero(data);
+    }
+
+    template<BitWidth bits>
+    [[nodiscard]] constexpr bool has_single_bit(bigint<bits, Signedness::Unsigned> const &data) noexcept {
+        auto found = false;
+        for (auto const limb: detail::limb_access::limbs(data)) {
+            if (limb != 0) {
+                if (found or not std::has_single_bit(limb)) {
+                    return false;
+                }
+                found = true;
+            }
+        }
+        return found;
+    }
+
+    // The largest power of two not above data, zero for zero.
+    template<BitWidth bits>
+    [[nodiscard]] constexpr bigint<bits, Signedness::Unsigned> bit_floor(bigint<bits, Signedness::Unsigned> const &data) {
+        auto result = bigint<bits, Signedness::Unsigned>{};
+        if (auto const width = bit_width(data); width != 0) {
+            result.set_bit(static_cast<std::size_t>(width - 1));
+        }
+        return result;
+    }
+
+    // The smallest power of two not below data. Throws std::overflow_error if that power does not fit the width.
+    template<BitWidth bits>
+    [[nodiscard]] constexpr bigint<bits, Signedness::Unsigned> bit_ceil(bigint<bits, Signedness::Unsigned> const &data) {
+        auto result = bigint<bits, Signedness::Unsigned>{};
+        if (data <= std::uint8_t{1}) {
+            return result.set_bit(0);
+        }
+        auto const width = static_cast<std::size_t>(bit_width(data - std::uint8_t{1}));
+        if (width == std::to_underlying(bits)) {
+            throw std::overflow_error("Overflow in bit_ceil");
+        }
+        return result.set_bit(width);
+    }
+
+    // data * data, truncated like operator*. Each cross product of two limbs is computed once and doubled, which
+    // makes a square close to twice as fast as a general product of the same width.
+    template<BitWidth bits, Signedness signedness>
+    constexpr bigint<bits, signedness> square(bigint<bits, signedness> const &data) {
+        auto result = bigint<bits, signedness>{};
+        bigint<bits, signedness>::multiply_low(result.data_, data.data_, data.data_);
+        return result;
+    }
+
+    // The full product a * b in a type as wide as both operands together, so nothing is truncated and nothing can
+    // overflow. Signed operands are multiplied as magnitudes and the product is negated if their signs differ.
+    template<BitWidth a_bits, Signedness a_signedness, BitWidth b_bits, Signedness b_signedness>
+    constexpr detail::widening_product<a_bits, a_signedness, b_bits, b_signedness>
+    widening_mul(bigint<a_bits, a_signedness> const &a, bigint<b_bits, b_signedness> const &b) {
+        using product_type = detail::widening_product<a_bits, a_signedness, b_bits, b_signedness>;
+        using a_limb = typename bigint<a_bits, a_signedness>::limb_type;
+        using b_limb = typename bigint<b_bits, b_signedness>::limb_type;
+        // The narrower limb type divides both widths and their sum, so the product limbs can be packed from it.
+        using limb_type = std::conditional_t<(sizeof(a_limb) < sizeof(b_limb)), a_limb, b_limb>;
+        constexpr auto limb_bits = std::size_t{sizeof(limb_type) * CHAR_BIT};
+        constexpr auto an = std::size_t{std::to_underlying(a_bits) / limb_bits};
+        constexpr auto bn = std::size_t{std::to_underlying(b_bits) / limb_bits};
+
+        auto const magnitude_limbs = []<std::size_t n>(auto const &magnitude) {
+            auto limbs = std::array<limb_type, n>{};
+            for (auto const i: std::views::iota(0uz, n)) {
+                limbs[i] = magnitude.template limb_as<limb_type>(i);
+            }
+            return limbs;
+        };
+        auto const x = magnitude_limbs.template operator()<an>(a.magnitude());
+        auto product = std::array<limb_type, an + bn>{};
+        if (static_cast<void const *>(&a) == &b) {
+            if constexpr (an == bn) {
+                detail::multiply_product(product, x, x);
+            }
+        } else {
+            detail::multiply_product(product, x, magnitude_limbs.template operator()<bn>(b.magnitude()));
+        }
+
+        auto result = product_type{};
+        constexpr auto ratio = std::size_t{sizeof(typename product_type::limb_type) / sizeof(limb_type)};
+        for (auto const i: std::views::iota(0uz, product_type::limb_count)) {
+            auto limb = typename product_type::limb_type{0};
+            for (auto const k: std::views::iota(0uz, ratio)) {
+                limb |= static_cast<typename product_type::limb_type>(
+                    static_cast<typename product_type::limb_type>(product[i * ratio + k]) << (k * limb_bits));
+            }
+            result.data_[i] = limb;
+        }
+        if (a.is_negative() != b.is_negative()) {
+            result.negate();
+        }
+        return result;
+    }
+
+    // The high half of the full product a * b, the bits operator* discards.
+    template<BitWidth bits, Signedness signedness>
+    constexpr bigint<bits, signedness> mul_hi(bigint<bits, signedness> const &a, bigint<bits, signedness> const &b) {
+        using value_type = bigint<bits, signedness>;
+        using limb_type = typename value_type::limb_type;
+        auto const product = widening_mul(a, b);
+        auto result = value_type{};
+        for (auto const i: std::views::iota(0uz, value_type::limb_count)) {
+            result.data_[i] = product.template limb_as<limb_type>(value_type::limb_count + i);
+        }
+        return result;
+    }
+
+    template<BitWidth bits>
+    class montgomery_int;
+
+    // Precomputed constants for arithmetic modulo a fixed odd modulus m in Montgomery form, where x is represented
+    // by x R mod m with R = 2^bits. Products then reduce with multiplications and shifts only, no division.
+    template<BitWidth bits>
+    class montgomery_context final {
+    public:
+        using value_type = bigint<bits, Signedness::Unsigned>;
+        using limb_type = typename value_type::limb_type;
+        using limbs_type = std::array<limb_type, value_type::limb_count>;
+
+        [[nodiscard]] constexpr explicit montgomery_context(value_type const &modulus) : modulus_{modulus} {
+            auto const &m = detail::limb_access::limbs(modulus_);
+            if ((m[0] & 1) == 0 or modulus_ == std::uint8_t{1}) {
+                throw std::invalid_argument("Montgomery arithmetic needs an odd modulus greater than one.");
+            }
+            inverse_ = detail::negative_inverse(m[0]);
+            // R - 1 = ~0, so R mod m follows from a single reduction. Doubling it bits times gives R^2 mod m.
+            auto const r_minus_one = ~value_type{} % modulus_;
+            auto one = limbs_type{};
+            one[0] = 1;
+            one_ = detail::add_mod(detail::limb_access::limbs(r_minus_one), one, m);
+            r_squared_ = one_;
+            for (auto i = 0uz; i < std::to_underlying(bits); ++i) {
+                r_squared_ = detail::add_mod(r_squared_, r_squared_, m);
+            }
+        }
+
+        [[nodiscard]] constexpr value_type const &modulus() const noexcept {
+            return modulus_;
+        }
+
+        // value mod m in Montgomery form.
+        [[nodiscard]] constexpr montgomery_int<bits> to_montgomery(value_type const &value) const {
+            auto const &reduced = value < modulus_ ? value : value % modulus_;
+            return montgomery_int<bits>{
+                *this, detail::montgomery_multiply(detail::limb_access::limbs(reduced), r_squared_, limbs(), inverse_)
+            };
+        }
+
+        [[nodiscard]] constexpr montgomery_int<bits> zero() const noexcept {
+            return montgomery_int<bits>{*this, limbs_type{}};
+        }
+
+        [[nodiscard]] constexpr montgomery_int<bits> one() const noexcept {
+            return montgomery_int<bits>{*this, one_};
+        }
+
+    private:
+        friend class montgomery_int<bits>;
+
+        [[nodiscard]] constexpr limbs_type const &limbs() const noexcept {
+            return detail::limb_access::limbs(modulus_);
+        }
+
+        value_type modulus_;
+        limbs_type one_{};
+        limbs_type r_squared_{};
+        limb_type inverse_{};
+    };
+
+    // A residue modulo the modulus of a montgomery_context, kept in Montgomery form between operations. It refers to
+    // its context, which has to outlive it, and both operands of an operation have to share the same context.
+    template<BitWidth bits>
+    class montgomery_int final {
+    public:
+        using context_type = montgomery_context<bits>;
+        using value_type = typename context_type::value_type;
+        using limbs_type = typename context_type::limbs_type;
+
+        [[nodiscard]] constexpr montgomery_int() = default;
+
+        [[nodiscard]] constexpr montgomery_int(context_type const &context, value_type const &value)
+            : montgomery_int{context.to_montgomery(value)} {
+        }
+
+        [[nodiscard]] constexpr context_type const &context() const noexcept {
+            return *context_;
+        }
+
+        // The residue converted back out of Montgomery form, in [0, m).
+        [[nodiscard]] constexpr value_type value() const noexcept {
+            auto t = std::array<typename context_type::limb_type, 2 * value_type::limb_count>{};
+            std::ranges::copy(value_, t.begin());
+            auto result = value_type{};
+            detail::limb_access::limbs(result) = detail::montgomery_reduce(t, context_->limbs(), context_->inverse_);
+            return result;
+        }
+
+        [[nodiscard]] constexpr explicit operator value_type() const noexcept {
+            return value();
+        }
+
+        constexpr montgomery_int &operator+=(montgomery_int const &other) noexcept {
+            value_ = detail::add_mod(value_, other.value_, context_->limbs());
+            return *this;
+        }
+
+        [[nodiscard]] constexpr montgomery_int operator+(montgomery_int const &other) const noexcept {
+            auto result = montgomery_int{*this};
+            result += other;
+            return result;
+        }
+
+        constexpr montgomery_int &operator-=(montgomery_int const &other) noexcept {
+            value_ = detail::sub_mod(value_, other.value_, context_->limbs());
+            return *this;
+        }
+
+        [[nodiscard]] constexpr montgomery_int operator-(montgomery_int const &other) const noexcept {
+            auto result = montgomery_int{*this};
+            result -= other;
+            return result;
+        }
+
+        [[nodiscard]] constexpr montgomery_int operator-() const noexcept {
+            return context_->zero() - *this;
+        }
+
+        constexpr montgomery_int &operator*=(montgomery_int const &other) {
+            if (this == &other) {
+                value_ = detail::montgomery_square(value_, context_->limbs(), context_->inverse_);
+            } else {
+                value_ = detail::montgomery_multiply(value_, other.value_, context_->limbs(), context_->inverse_);
+            }
+            return *this;
+        }
+
+        [[nodiscard]] constexpr montgomery_int operator*(montgomery_int const &other) const {
+            if (this == &other) {
+                return square(*this);
+            }
+            auto result = montgomery_int{*this};
+            result *= other;
+            return result;
+        }
+
+        [[nodiscard]] constexpr bool operator==(montgomery_int const &other) const noexcept {
+            return value_ == other.value_;
+        }
+
+        // x^2 in Montgomery form, a full square followed by a single reduction.
+        [[nodiscard]] friend constexpr montgomery_int square(montgomery_int const &x) {
+            auto result = montgomery_int{x};
+            result *= result;
+            return result;
+        }
+
+    private:
+        friend class montgomery_context<bits>;
+
+        [[nodiscard]] constexpr montgomery_int(context_type const &context, limbs_type const &value) noexcept
+            : value_{value}, context_{&context} {
+        }
+
+        limbs_type value_{};
+        context_type const *context_{nullptr};
+    };
+
+    namespace detail {
+        // Window width for sliding window exponentiation. A wider window saves multiplications while scanning the
+        // exponent but doubles the table of odd powers; these are the exponent lengths where that starts to pay off.
+        [[nodiscard]] constexpr std::size_t sliding_window_width(std::size_t const exponent_bits) noexcept {
+            if (exponent_bits > 671) {
+                return 6;
+            }
+            if (exponent_bits > 239) {
+                return 5;
+            }
+            if (exponent_bits > 79) {
+                return 4;
+            }
+            if (exponent_bits > 23) {
+                return 3;
+            }
+            return 1;
+        }
+
+        // The exponent as an unsigned value of the same width, which must not be negative.
+        template<BitWidth bits, Signedness signedness>
+        [[nodiscard]] constexpr bigint<bits, Signedness::Unsigned> exponent_magnitude(
+            bigint<bits, signedness> const &exponent) {
+            if (exponent < std::int8_t{0}) {
+                throw std::invalid_argument("The exponent must not be negative.");
+            }
+            return bigint<bits, Signedness::Unsigned>{exponent};
+        }
+
+        // base^exponent with left-to-right sliding windows (Menezes, van Oorschot and Vanstone, Handbook of Applied
+        // Cryptography, algorithm 14.85). Every run of at most w bits that starts and ends with a one costs a single
+        // multiplication by one of the precomputed odd powers base^1, base^3, ..., base^(2^w - 1).
+        // multiply(x, x) has to square x.
+        template<typename value_type, std::unsigned_integral limb_type, std::size_t size, typename multiply_type>
+        [[nodiscard]] constexpr value_type power_sliding_window(value_type const &base, value_type const &one,
+                                                                std::array<limb_type, size> const &exponent,
+                                                                multiply_type const &multiply) {
+            constexpr auto limb_bits = std::size_t{sizeof(limb_type) * CHAR_BIT};
+            auto const bit = [&exponent](std::size_t const i) {
+                return static_cast<std::size_t>((exponent[i / limb_bits] >> (i % limb_bits)) & 1);
+            };
+            auto const length = significant_bits(exponent);
+            if (length == 1 and bit(0) == 0) {
+                return one;
+            }
+
+            auto const width = sliding_window_width(length);
+            auto odd_powers = std::vector<value_type>(std::size_t{1} << (width - 1));
+            odd_powers[0] = base;
+            if (odd_powers.size() > 1) {
+                auto const base_squared = multiply(base, base);
+                for (auto i = 1uz; i < odd_powers.size(); ++i) {
+                    odd_powers[i] = multiply(odd_powers[i - 1], base_squared);
+                }
+            }
+
+            auto result = one;
+            auto started = false;
+            for (auto i = length; i > 0;) {
+                if (bit(i - 1) == 0) {
+                    result = multiply(result, result);
+                    --i;
+                    continue;
+                }
+                // The window covers bits [low, i) and ends with the lowest one bit in reach.
+                auto low = i > width ? i - width : 0uz;
+                while (bit(low) == 0) {
+                    ++low;
+                }
+                auto window = 0uz;
+                for (auto j = i; j > low; --j) {
+                    window = window << 1 | bit(j - 1);
+                    if (started) {
+                        result = multiply(result, result);
+                    }
+                }
+                result = started ? multiply(result, odd_powers[window / 2]) : odd_powers[window / 2];
+                started = true;
+                i = low;
+            }
+            return result;
+        }
+    }
+
+    // x^exponent in Montgomery form, with sliding windows sized for the exponent.
+    template<BitWidth bits, BitWidth exponent_bits, Signedness exponent_signedness>
+    constexpr montgomery_int<bits> pow(montgomery_int<bits> const &x,
+                                       bigint<exponent_bits, exponent_signedness> const &exponent) {
+        auto const magnitude = detail::exponent_magnitude(exponent);
+        return detail::power_sliding_window(x, x.context().one(), detail::limb_access::limbs(magnitude),
+                                            [](montgomery_int<bits> const &a, montgomery_int<bits> const &b) {
+                                                return a * b;
+                                            });
+    }
+
+    template<BitWidth bits, std::integral T>
+    constexpr montgomery_int<bits> pow(montgomery_int<bits> const &x, T const exponent) {
+        return pow(x, bigint<BitWidth{sizeof(T) * CHAR_BIT}, std::is_signed_v<T> ? Signedness::Signed : Signedness::Unsigned>{exponent});
+    }
+
+    // base^exponent mod modulus. Odd moduli are handled in Montgomery form, even ones reduce every product with a
+    // division. The result lies in [0, modulus), also for a negative base.
+    template<BitWidth bits, Signedness signedness, BitWidth exponent_bits, Signedness exponent_signedness>
+    constexpr bigint<bits, signedness> powmod(bigint<bits, signedness> const &base,
+                                              bigint<exponent_bits, exponent_signedness> const &exponent,
+                                              bigint<bits, signedness> const &modulus) {
+        using value_type = bigint<bits, Signedness::Unsigned>;
+        using wide_type = bigint<BitWidth{2 * std::to_underlying(bits)}, Signedness::Unsigned>;
+        if (modulus == std::int8_t{0}) {
+            throw std::overflow_error("Division by zero");
+        }
+        if (modulus < std::int8_t{0}) {
+            throw std::invalid_argument("The modulus must be positive.");
+        }
+        auto const magnitude = detail::exponent_magnitude(exponent);
+        auto const m = value_type{modulus};
+        if (m == std::uint8_t{1}) {
+            return {};
+        }
+
+        auto reduced = base % modulus;
+        if (reduced < std::int8_t{0}) {
+            reduced += modulus;
+        }
+        auto const residue = value_type{reduced};
+        auto const &exponent_limbs = detail::limb_access::limbs(magnitude);
+        if ((detail::limb_access::limbs(m)[0] & 1) != 0) {
+            auto const context = montgomery_context<bits>{m};
+            return bigint<bits, signedness>{pow(context.to_montgomery(residue), magnitude).value()};
+        }
+
+        auto const wide_modulus = wide_type{m};
+        auto const one = value_type{std::uint8_t{1}};
+        return bigint<bits, signedness>{
+            detail::power_sliding_window(residue, one, exponent_limbs, [&wide_modulus](value_type const &a, value_type const &b) {
+                return detail::limb_access::truncate<value_type>(widening_mul(a, b) % wide_modulus);
+            })
+        };
+    }
+
+    template<BitWidth bits, Signedness signedness, std::integral T>
+    constexpr bigint<bits, signedness> powmod(bigint<bits, signedness> const &base, T const exponent,
+                                              bigint<bits, signedness> const &modulus) {
+        return powmod(base, bigint<BitWidth{sizeof(T) * CHAR_BIT}, std::is_signed_v<T> ? Signedness::Signed : Signedness::Unsigned>{exponent},
+                      modulus);
+    }
+
+    namespace detail {
+        // Window width w that minimizes the ceil(exponent_bits / w) + 2^w multiplications of a fixed base power.
+        [[nodiscard]] constexpr std::size_t fixed_base_window_width(std::size_t const exponent_bits) noexcept {
+            auto best = 1uz;
+            for (auto width = 2uz; width <= 8; ++width) {
+                auto const cost = [exponent_bits](std::size_t const w) {
+                    return (exponent_bits + w - 1) / w + (std::size_t{1} << w);
+                };
+                if (cost(width) < cost(best)) {
+                    best = width;
+                }
+            }
+            return best;
+        }
+    }
+
+    // Precomputed powers g^(2^(w i)) of a fixed base g in Montgomery form. An exponent split into base 2^w digits
+    // e_i then needs no squarings at all: g^e = prod_d (prod_{e_i >= d} g^(2^(w i))) (Brickell, Gordon, McCurley and
+    // Wilson, "Fast exponentiation with precomputation"). That is about exponent_bits / w + 2^w multiplications
+    // instead of the exponent_bits squarings of pow. Exponents longer than the table fall back to pow.
+    template<BitWidth bits>
+    class fixed_base_table final {
+    public:
+        [[nodiscard]] constexpr explicit fixed_base_table(montgomery_int<bits> const &base,
+                                                          std::size_t const max_exponent_bits = std::to_underlying(bits))
+            : base_{base},
+              width_{detail::fixed_base_window_width(std::max(max_exponent_bits, std::size_t{1}))},
+              powers_((std::max(max_exponent_bits, std::size_t{1}) + width_ - 1) / width_) {
+            powers_[0] = base;
+            for (auto i = 1uz; i < powers_.size(); ++i) {
+                powers_[i] = powers_[i - 1];
+                for (auto j = 0uz; j < width_; ++j) {
+                    powers_[i] *= powers_[i];
+                }
+            }
+        }
+
+        [[nodiscard]] constexpr montgomery_int<bits> const &base() const noexcept {
+            return base_;
+        }
+
+        template<BitWidth exponent_bits, Signedness exponent_signedness>
+        [[nodiscard]] constexpr montgomery_int<bits> pow(bigint<exponent_bits, exponent_signedness> const &exponent) const {
+            using limb_type = typename bigint<exponent_bits, Signedness::Unsigned>::limb_type;
+            constexpr auto limb_bits = std::size_t{sizeof(limb_type) * CHAR_BIT};
+            auto const magnitude = detail::exponent_magnitude(exponent);
+            auto const &limbs = detail::limb_access::limbs(magnitude);
+            auto const digit_count = (detail::significant_bits(limbs) + width_ - 1) / width_;
+            if (digit_count > powers_.size()) {
+                return ::bigint::pow(base_, magnitude);
+            }
+
+            auto digits = std::vector<std::size_t>(digit_count);
+            for (auto i = 0uz; i < digit_count * width_; ++i) {
+                if (i < std::to_underlying(exponent_bits) and ((limbs[i / limb_bits] >> (i % limb_bits)) & 1) != 0) {
+                    digits[i / width_] |= std::size_t{1} << (i % width_);
+                }
+            }
+
+            // product collects the powers of all digits >= d; result multiplies it in once for every d.
+            auto const one = base_.context().one();
+            auto product = one;
+            auto result = one;
+            auto product_started = false;
+            auto result_started = false;
+            for (auto d = (std::size_t{1} << width_) - 1; d > 0; --d) {
+                for (auto i = 0uz; i < digit_count; ++i) {
+                    if (digits[i] == d) {
+                        product = product_started ? product * powers_[i] : powers_[i];
+                        product_started = true;
+                    }
+                }
+                if (product_started) {
+                    result = result_started ? result * product : product;
+                    result_started = true;
+                }
+            }
+            return result;
+        }
+
+        template<std::integral T>
+        [[nodiscard]] constexpr montgomery_int<bits> pow(T const exponent) const {
+            return pow(bigint<BitWidth{sizeof(T) * CHAR_BIT}, std::is_signed_v<T> ? Signedness::Signed : Signedness::Unsigned>{exponent});
+        }
+
+    private:
+        montgomery_int<bits> base_;
+        std::size_t width_;
+        std::vector<montgomery_int<bits> > powers_;
+    };
+
+    // A fixed divisor prepared for many divisions (Barrett, "Implementing the Rivest Shamir and Adleman public key
+    // encryption algorithm on a standard digital signal processor"). For a divisor d of l bits and dividends below
+    // 2^bits the reciprocal mu = floor(2^(bits + l) / d) is computed once. A quotient estimate
+    // floor(floor(x / 2^(l - 1)) mu / 2^(bits + 1)) is then at most two too small, so every division takes two
+    // multiplications and at most two corrective subtractions. Divisors that fit a single limb use the two-by-one
+    // limb reciprocal of short division instead.
+    template<BitWidth bits>
+    class barrett_divisor final {
+    public:
+        using value_type = bigint<bits, Signedness::Unsigned>;
+        using limb_type = typename value_type::limb_type;
+        static constexpr std::size_t limb_bits = value_type::limb_bits;
+        static constexpr std::size_t limb_count = value_type::limb_count;
+
+        [[nodiscard]] constexpr explicit barrett_divisor(value_type const &divisor)
+            : divisor_{divisor},
+              divisor_bits_{detail::significant_bits(detail::limb_access::limbs(divisor))},
+              short_divisor_{non_zero(detail::limb_access::limbs(divisor)[0])} {
+            if (divisor == std::uint8_t{0}) {
+                throw std::overflow_error("Division by zero");
+            }
+            if (divisor_bits_ <= limb_bits) {
+                return;
+            }
+            // 2^(bits + l) needs up to 2 limb_count + 1 limbs, mu itself at most limb_count + 1.
+            constexpr auto wide_count = 2 * limb_count + 1;
+            auto numerator = std::array<limb_type, wide_count>{};
+            auto const power = std::to_underlying(bits) + divisor_bits_;
+            numerator[power / limb_bits] = static_cast<limb_type>(limb_type{1} << (power % limb_bits));
+            auto denominator = std::array<limb_type, wide_count>{};
+            std::ranges::copy(detail::limb_access::limbs(divisor), denominator.begin());
+            auto quotient = std::array<limb_type, wide_count>{};
+            auto remainder = std::array<limb_type, wide_count>{};
+            detail::divide_limbs(numerator, denominator, quotient, remainder);
+            std::copy_n(quotient.begin(), limb_count + 1, reciprocal_.begin());
+            reciprocal_size_ = limb_count + 1;
+            while (reciprocal_size_ > 0 and reciprocal_[reciprocal_size_ - 1] == 0) {
+                --reciprocal_size_;
+            }
+        }
+
+        [[nodiscard]] constexpr value_type const &divisor() const noexcept {
+            return divisor_;
+        }
+
+        [[nodiscard]] constexpr divmod_result<value_type> divmod(value_type const &dividend) const noexcept {
+            auto quotient = dividend;
+            auto remainder = value_type{};
+            auto &q = detail::limb_access::limbs(quotient);
+            auto &r = detail::limb_access::limbs(remainder);
+            if (divisor_bits_ <= limb_bits) {
+                r[0] = detail::short_divide(q.data(), significant(q), short_divisor_);
+                return {quotient, remainder};
+            }
+
+            auto const &x = detail::limb_access::limbs(dividend);
+            auto const &d = detail::limb_access::limbs(divisor_);
+            // q1 = x >> (l - 1), with l > limb_bits the shift always drops at least one limb.
+            auto const limb_shift = (divisor_bits_ - 1) / limb_bits;
+            auto const bit_shift = (divisor_bits_ - 1) % limb_bits;
+            auto shifted = std::array<limb_type, limb_count>{};
+            for (auto i = 0uz; i + limb_shift < limb_count; ++i) {
+                auto const upper = i + limb_shift + 1 < limb_count ? x[i + limb_shift + 1] : limb_type{0};
+                shifted[i] = bit_shift == 0
+                                 ? x[i + limb_shift]
+                                 : static_cast<limb_type>((x[i + limb_shift] >> bit_shift) | (upper << (limb_bits - bit_shift)));
+            }
+            auto const shifted_size = significant(shifted);
+
+            // q = (q1 mu) >> (bits + 1), read from limb limb_count on.
+            auto product = std::array<limb_type, 2 * limb_count + 1>{};
+            detail::multiply_basecase(product.data(), shifted.data(), shifted_size, reciprocal_.data(), reciprocal_size_);
+            for (auto i = 0uz; i < limb_count; ++i) {
+                q[i] = static_cast<limb_type>((product[limb_count + i] >> 1) | (product[limb_count + i + 1] << (limb_bits - 1)));
+            }
+
+            // r = x - q d < 3 d fits the k + 1 limbs above the k limbs of d, so only those limbs of q d are formed.
+            auto const low_size = std::min((divisor_bits_ + limb_bits - 1) / limb_bits + 1, limb_count);
+            auto const quotient_size = std::min(significant(q), low_size);
+            std::fill_n(product.begin(), low_size, limb_type{0});
+            for (auto i = 0uz; i < quotient_size; ++i) {
+                auto carry = limb_type{0};
+                for (auto j = 0uz; i + j < low_size; ++j) {
+                    auto const partial = detail::mul_wide(q[i], d[j]);
+                    auto overflow = limb_type{0};
+                    auto const low = detail::add_carry(partial.low, carry, limb_type{0}, overflow);
+                    auto const high = static_cast<limb_type>(partial.high + overflow);
+                    product[i + j] = detail::add_carry(product[i + j], low, limb_type{0}, overflow);
+                    carry = static_cast<limb_type>(high + overflow);
+                }
+            }
+            detail::sub_n(r.data(), x.data(), product.data(), low_size);
+            auto const one = limb_type{1};
+            while (detail::compare_n(r.data(), low_size, d.data(), low_size) >= 0) {
+                detail::sub_n(r.data(), r.data(), d.data(), low_size);
+                detail::add_into(q.data(), limb_count, &one, 1);
+            }
+            return {quotient, remainder};
+        }
+
+        [[nodiscard]] constexpr value_type divide(value_type const &dividend) const noexcept {
+            return divmod(dividend).quotient;
+        }
+
+        [[nodiscard]] constexpr value_type remainder(value_type const &dividend) const noexcept {
+            return divmod(dividend).remainder;
+        }
+
+    private:
+        // limb_divisor needs a non-zero value; a zero divisor is rejected in the constructor body.
+        [[nodiscard]] static constexpr limb_type non_zero(limb_type const value) noexcept {
+            return value == 0 ? limb_type{1} : value;
+        }
+
+        [[nodiscard]] static constexpr std::size_t significant(std::array<limb_type, limb_count> const &limbs) noexcept {
+            auto size = limb_count;
+            while (size > 0 and limbs[size - 1] == 0) {
+                --size;
+            }
+            return size;
+        }
+
+        value_type divisor_;
+        std::size_t divisor_bits_;
+        detail::limb_divisor<limb_type> short_divisor_;
+        std::array<limb_type, limb_count + 1> reciprocal_{};
+        std::size_t reciprocal_size_{0};
+    };
+
+    namespace detail {
+        using field_limbs = std::array<std::uint64_t, 4>;
+        using wide_field_limbs = std::array<std::uint64_t, 8>;
+
+        // Field elements are kept in [0, 2^256) rather than [0, p), 2^256 = fold mod p takes care of every carry.
+        // A carry out of the first fold leaves a value below fold, so the second fold never carries again.
+        constexpr void add_folded(field_limbs &r, field_limbs const &b, field_limbs const &fold) noexcept {
+            if (add_limbs(r, b) != 0 and add_limbs(r, fold) != 0) {
+                add_limbs(r, fold);
+            }
+        }
+
+        // r - b, a borrow takes 2^256 away and so has to be compensated by subtracting fold.
+        constexpr void sub_folded(field_limbs &r, field_limbs const &b, field_limbs const &fold) noexcept {
+            if (sub_limbs(r, b) != 0 and sub_limbs(r, fold) != 0) {
+                sub_limbs(r, fold);
+            }
+        }
+
+        // The representative of r in [0, p), r < 2^256 is less than 3 p for every supported prime.
+        constexpr void canonicalize(field_limbs &r, field_limbs const &p) noexcept {
+            while (compare_n(r.data(), r.size(), p.data(), p.size()) >= 0) {
+                sub_limbs(r, p);
+            }
+        }
+
+        // t mod p for p = 2^256 - c with a single limb c: the upper half is multiplied by c and added to the lower
+        // half twice, the second time with a top limb small enough for a single carry fold to finish.
+        template<std::uint64_t c>
+        constexpr void reduce_pseudo_mersenne(field_limbs &r, wide_field_limbs const &t) noexcept {
+            auto carry = std::uint64_t{0};
+            for (auto i = 0uz; i < 4; ++i) {
+                auto const product = mul_wide(t[i + 4], c);
+                auto overflow = std::uint64_t{0};
+                auto const low = add_carry(product.low, carry, std::uint64_t{0}, overflow);
+                auto const high = product.high + overflow;
+                r[i] = add_carry(t[i], low, std::uint64_t{0}, overflow);
+                carry = high + overflow;
+            }
+            auto const product = mul_wide(carry, c);
+            auto const folded = field_limbs{product.low, product.high, 0, 0};
+            if (add_limbs(r, folded) != 0) {
+                add_limbs(r, field_limbs{c, 0, 0, 0});
+            }
+        }
+
+        // t mod p for the NIST prime p = 2^256 - 2^224 + 2^192 + 2^96 - 1 (FIPS 186-4, D.2.3): with 32 bit words c0
+        // to c15 the residue is a signed sum of nine 256 bit rearrangements of the words. The sum is carried in 64 bit
+        // accumulators, what is left above 2^256 is at most a few multiples of p.
+        constexpr void reduce_p256(field_limbs &r, wide_field_limbs const &t, field_limbs const &p) noexcept {
+            auto const c = [&t](std::size_t const i) {
+                return static_cast<std::int64_t>((t[i / 2] >> (i % 2 * 32)) & 0xFFFFFFFF);
+            };
+            auto const words = std::array<std::int64_t, 8>{
+                c(0) + c(8) + c(9) - c(11) - c(12) - c(13) - c(14),
+                c(1) + c(9) + c(10) - c(12) - c(13) - c(14) - c(15),
+                c(2) + c(10) + c(11) - c(13) - c(14) - c(15),
+                c(3) + 2 * (c(11) + c(12)) + c(13) - c(15) - c(8) - c(9),
+                c(4) + 2 * (c(12) + c(13)) + c(14) - c(9) - c(10),
+                c(5) + 2 * (c(13) + c(14)) + c(15) - c(10) - c(11),
+                c(6) + 3 * c(14) + 2 * c(15) + c(13) - c(8) - c(9),
+                c(7) + 3 * c(15) + c(8) - c(10) - c(11) - c(12) - c(13),
+            };
+            auto carry = std::int64_t{0};
+            for (auto i = 0uz; i < 8; i += 2) {
+                carry += words[i];
+                auto const low = static_cast<std::uint64_t>(carry) & 0xFFFFFFFF;
+                carry >>= 32;
+                carry += words[i + 1];
+                r[i / 2] = low | static_cast<std::uint64_t>(carry) << 32;
+                carry >>= 32;
+            }
+            while (carry < 0) {
+                carry += static_cast<std::int64_t>(add_limbs(r, p));
+            }
+            while (carry > 0) {
+                carry -= static_cast<std::int64_t>(sub_limbs(r, p));
+            }
+        }
+    }
+
+    // The field of integers modulo 2^255 - 19, the prime of Curve25519 and Ed25519.
+    struct curve25519_prime {
+        static constexpr detail::field_limbs modulus{
+            0xFFFFFFFFFFFFFFED, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x7FFFFFFFFFFFFFFF
+        };
+        // 2^256 mod p.
+        static constexpr detail::field_limbs fold{38, 0, 0, 0};
+
+        static constexpr void reduce(detail::field_limbs &r, detail::wide_field_limbs const &t) noexcept {
+            detail::reduce_pseudo_mersenne<38>(r, t);
+        }
+    };
+
+    // The field of integers modulo 2^256 - 2^32 - 977, the prime of secp256k1.
+    struct secp256k1_prime {
+        static constexpr detail::field_limbs modulus{
+            0xFFFFFFFEFFFFFC2F, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF
+        };
+        static constexpr detail::field_limbs fold{0x1000003D1, 0, 0, 0};
+
+        static constexpr void reduce(detail::field_limbs &r, detail::wide_field_limbs const &t) noexcept {
+            detail::reduce_pseudo_mersenne<0x1000003D1>(r, t);
+        }
+    };
+
+    // The field of integers modulo 2^256 - 2^224 + 2^192 + 2^96 - 1, the prime of NIST P-256.
+    struct p256_prime {
+        static constexpr detail::field_limbs modulus{
+            0xFFFFFFFFFFFFFFFF, 0x00000000FFFFFFFF, 0x0000000000000000, 0xFFFFFFFF00000001
+        };
+        static constexpr detail::field_limbs fold{
+            0x0000000000000001, 0xFFFFFFFF00000000, 0xFFFFFFFFFFFFFFFF, 0x00000000FFFFFFFE
+        };
+
+        static constexpr void reduce(detail::field_limbs &r, detail::wide_field_limbs const &t) noexcept {
+            detail::reduce_p256(r, t, modulus);
+        }
+    };
+
+    // An element of the prime field described by prime, one of the primes above. Products reduce with the special
+    // form of the prime instead of a division. Between operations the value is only kept below 2^256, value()
+    // returns the representative in [0, p).
+    template<typename prime>
+    class field_element final {
+    public:
+        using prime_type = prime;
+        using value_type = bigint<BitWidth{256}, Signedness::Unsigned>;
+        using limbs_type = detail::field_limbs;
+
+        [[nodiscard]] static constexpr value_type modulus() noexcept {
+            auto result = value_type{};
+            detail::limb_access::limbs(result) = prime::modulus;
+            return result;
+        }
+
+        [[nodiscard]] constexpr field_element() = default;
+
+        // value mod p, every 256 bit value is a valid representative so nothing is reduced here.
+        [[nodiscard]] constexpr explicit field_element(value_type const &value) noexcept
+            : value_{detail::limb_access::limbs(value)} {
+        }
+
+        [[nodiscard]] constexpr value_type value() const noexcept {
+            auto result = value_type{};
+            auto &limbs = detail::limb_access::limbs(result);
+            limbs = value_;
+            detail::canonicalize(limbs, prime::modulus);
+            return result;
+        }
+
+        [[nodiscard]] constexpr explicit operator value_type() const noexcept {
+            return value();
+        }
+
+        constexpr field_element &operator+=(field_element const &other) noexcept {
+            detail::add_folded(value_, other.value_, prime::fold);
+            return *this;
+        }
+
+        [[nodiscard]] constexpr field_element operator+(field_element const &other) const noexcept {
+            auto result = field_element{*this};
+            result += other;
+            return result;
+        }
+
+        constexpr field_element &operator-=(field_element const &other) noexcept {
+            detail::sub_folded(value_, other.value_, prime::fold);
+            return *this;
+        }
+
+        [[nodiscard]] constexpr field_element operator-(field_element const &other) const noexcept {
+            auto result = field_element{*this};
+            result -= other;
+            return result;
+        }
+
+        [[nodiscard]] constexpr field_element operator-() const noexcept {
+            return field_element{} - *this;
+        }
+
+        constexpr field_element &operator*=(field_element const &other) {
+            auto t = detail::wide_field_limbs{};
+            detail::multiply_product(t, value_, other.value_);
+            prime::reduce(value_, t);
+            return *this;
+        }
+
+        [[nodiscard]] constexpr field_element operator*(field_element const &other) const {
+            auto result = field_element{*this};
+            result *= other;
+            return result;
+        }
+
+        [[nodiscard]] constexpr bool operator==(field_element const &other) const noexcept {
+            return value() == other.value();
+        }
+
+        [[nodiscard]] friend constexpr field_element square(field_element const &x) {
+            auto result = field_element{x};
+            result *= result;
+            return result;
+        }
+
+        // x^(p - 2) = x^-1 by Fermat's little theorem, zero has no inverse.
+        [[nodiscard]] friend constexpr field_element invert(field_element const &x) {
+            if (x.value() == std::uint8_t{0}) {
+                throw std::invalid_argument("Zero has no inverse.");
+            }
+            auto exponent = prime::modulus;
+            detail::sub_limbs(exponent, limbs_type{2, 0, 0, 0});
+            return detail::power_sliding_window(x, field_element{value_type{std::uint8_t{1}}}, exponent,
+                                                [](field_element const &a, field_element const &b) {
+                                                    return a * b;
+                                                });
+        }
+
+    private:
+        limbs_type value_{};
+    };
+
+    using curve25519_field = field_element<curve25519_prime>;
+    using secp256k1_field = field_element<secp256k1_prime>;
+    using p256_field = field_element<p256_prime>;
+
+    namespace detail {
+        // Hides value from the optimizer, so arithmetic on masks derived from it is not turned back into branches.
+        template<std::unsigned_integral limb_type>
+        [[nodiscard]] constexpr limb_type value_barrier(limb_type value) noexcept {
+            if !consteval {
+#if defined(__GNUC__) or defined(__clang__)
+                asm("" : "+r"(value));
+#endif
+            }
+            return value;
+        }
+
+        // All ones for a bit of one, zero for a bit of zero.
+        template<std::unsigned_integral limb_type>
+        [[nodiscard]] constexpr limb_type bit_mask(limb_type const bit) noexcept {
+            return value_barrier(static_cast<limb_type>(limb_type{0} - bit));
+        }
+
+        // All ones if every limb is zero.
+        template<std::unsigned_integral limb_type, std::size_t n>
+        [[nodiscard]] constexpr limb_type zero_mask(std::array<limb_type, n> const &limbs) noexcept {
+            auto accumulated = limb_type{0};
+            for (auto const limb: limbs) {
+                accumulated |= limb;
+            }
+            // x | -x has the top bit set for every x except zero.
+            constexpr auto limb_bits = std::size_t{sizeof(limb_type) * CHAR_BIT};
+            auto const non_zero = static_cast<limb_type>((accumulated | static_cast<limb_type>(0 - accumulated)) >> (limb_bits - 1));
+            return bit_mask(static_cast<limb_type>(non_zero ^ 1));
+        }
+
+        // limbs = mask ? -limbs : limbs, as (limbs ^ mask) + (mask & 1).
+        template<std::unsigned_integral limb_type, std::size_t n>
+        constexpr void conditional_negate(std::array<limb_type, n> &limbs, limb_type const mask) noexcept {
+            auto carry = static_cast<limb_type>(mask & 1);
+            for (auto &limb: limbs) {
+                limb = add_carry(static_cast<limb_type>(limb ^ mask), limb_type{0}, carry, carry);
+            }
+        }
+
+        // All ones if a < b as unsigned values, read off the borrow of a full subtraction.
+        template<std::unsigned_integral limb_type, std::size_t n>
+        [[nodiscard]] constexpr limb_type less_mask(std::array<limb_type, n> const &a,
+                                                    std::array<limb_type, n> const &b) noexcept {
+            auto borrow = limb_type{0};
+            for (auto i = 0uz; i < n; ++i) {
+                static_cast<void>(sub_borrow(a[i], b[i], borrow, borrow));
+            }
+            return bit_mask(borrow);
+        }
+    }
 
-        template<BitWidth other_bits, Signedness other_is_signed>
-        friend constexpr std::ostream &print_oct(std::ostream &, bigint<other_bits, other_is_signed> const &);
+    // Constant-time counterparts of the operators for secret values. The sequence of instructions and memory accesses
+    // depends only on the widths of the operands, never on their values: every limb is visited, carries are never
+    // cut short and decisions are limb masks instead of branches. Only the result of equal, less and compare and
+    // the exception for a zero divisor reveal anything about the operands.
+    namespace ct {
+        // condition ? a : b.
+        template<BitWidth bits, Signedness signedness>
+        [[nodiscard]] constexpr bigint<bits, signedness> select(bool const condition, bigint<bits, signedness> const &a,
+                                                                bigint<bits, signedness> const &b) noexcept {
+            using limb_type = typename bigint<bits, signedness>::limb_type;
+            auto const mask = detail::bit_mask(static_cast<limb_type>(condition));
+            auto result = bigint<bits, signedness>{};
+            auto &r = detail::limb_access::limbs(result);
+            auto const &x = detail::limb_access::limbs(a);
+            auto const &y = detail::limb_access::limbs(b);
+            for (auto i = 0uz; i < r.size(); ++i) {
+                r[i] = static_cast<limb_type>(y[i] ^ (mask & (x[i] ^ y[i])));
+            }
+            return result;
+        }
 
-        template<BitWidth other_bits, Signedness other_is_signed>
-        friend constexpr std::ostream &print_dec(std::ostream &, bigint<other_bits, other_is_signed> const &);
+        // Swaps a and b if condition holds.
+        template<BitWidth bits, Signedness signedness>
+        constexpr void cswap(bool const condition, bigint<bits, signedness> &a, bigint<bits, signedness> &b) noexcept {
+            using limb_type = typename bigint<bits, signedness>::limb_type;
+            auto const mask = detail::bit_mask(static_cast<limb_type>(condition));
+            auto &x = detail::limb_access::limbs(a);
+            auto &y = detail::limb_access::limbs(b);
+            for (auto i = 0uz; i < x.size(); ++i) {
+                auto const difference = static_cast<limb_type>(mask & (x[i] ^ y[i]));
+                x[i] ^= difference;
+                y[i] ^= difference;
+            }
+        }
 
-        template<BitWidth other_bits, Signedness other_is_signed>
-        friend constexpr std::ostream &operator<<(std::ostream &, bigint<other_bits, other_is_signed> const &);
+        // a + b, wrapping like operator+.
+        template<BitWidth bits, Signedness signedness>
+        [[nodiscard]] constexpr bigint<bits, signedness> add(bigint<bits, signedness> const &a,
+                                                             bigint<bits, signedness> const &b) noexcept {
+            auto result = a;
+            static_cast<void>(detail::add_limbs(detail::limb_access::limbs(result), detail::limb_access::limbs(b)));
+            return result;
+        }
 
-        template<BitWidth other_bits, Signedness other_is_signed>
-        friend constexpr std::istream &operator>>(std::istream &, bigint<other_bits, other_is_signed> &);
-#endif
+        // a - b, wrapping like operator-.
+        template<BitWidth bits, Signedness signedness>
+        [[nodiscard]] constexpr bigint<bits, signedness> sub(bigint<bits, signedness> const &a,
+                                                             bigint<bits, signedness> const &b) noexcept {
+            auto result = a;
+            static_cast<void>(detail::sub_limbs(detail::limb_access::limbs(result), detail::limb_access::limbs(b)));
+            return result;
+        }
 
-        template<BitWidth other_bits, Signedness other_is_signed>
-        friend constexpr bigint<other_bits, other_is_signed> byteswap(bigint<other_bits, other_is_signed> const &);
+        // -a, the minimum of a signed type stays the minimum instead of throwing.
+        template<BitWidth bits, Signedness signedness>
+        [[nodiscard]] constexpr bigint<bits, signedness> negate(bigint<bits, signedness> const &a) noexcept {
+            using limb_type = typename bigint<bits, signedness>::limb_type;
+            auto result = a;
+            detail::conditional_negate(detail::limb_access::limbs(result), static_cast<limb_type>(~limb_type{0}));
+            return result;
+        }
 
-    private:
-        [[nodiscard]] constexpr bool get_bit(std::size_t const pos) const {
-            auto const byte_index = std::size_t{pos / CHAR_BIT};
-            auto const bit_index = std::size_t{pos % CHAR_BIT};
-            if constexpr (std::endian::native == std::endian::little) {
-                return (data_[byte_index] >> bit_index) & 1;
-            } else {
-                auto const index = std::size_t{data_.size() - 1 - byte_index};
-                return (data_[index] >> bit_index) & 1;
+        // a * b truncated to the width of the operands. The low half of a two's complement product does not depend
+        // on the signs, so signed operands need no magnitudes.
+        template<BitWidth bits, Signedness signedness>
+        [[nodiscard]] constexpr bigint<bits, signedness> mul(bigint<bits, signedness> const &a,
+                                                             bigint<bits, signedness> const &b) noexcept {
+            auto result = bigint<bits, signedness>{};
+            auto &r = detail::limb_access::limbs(result);
+            detail::multiply_low_basecase(r.data(), detail::limb_access::limbs(a).data(),
+                                          detail::limb_access::limbs(b).data(), r.size());
+            return result;
+        }
+
+        template<BitWidth bits, Signedness signedness>
+        [[nodiscard]] constexpr bool equal(bigint<bits, signedness> const &a, bigint<bits, signedness> const &b) noexcept {
+            auto difference = detail::limb_access::limbs(a);
+            auto const &y = detail::limb_access::limbs(b);
+            for (auto i = 0uz; i < difference.size(); ++i) {
+                difference[i] ^= y[i];
             }
+            return (detail::zero_mask(difference) & 1) != 0;
         }
 
-        constexpr void set_bit(std::size_t const pos, bool const value) {
-            auto const byte_index = std::size_t{pos / CHAR_BIT};
-            auto const bit_index = std::size_t{pos % CHAR_BIT};
-            if constexpr (std::endian::native == std::endian::little) {
-                if (value) {
-                    data_[byte_index] |= static_cast<std::uint8_t>(1U << bit_index);
-                } else {
-                    data_[byte_index] &= static_cast<std::uint8_t>(~(1U << bit_index));
+        template<BitWidth bits, Signedness signedness>
+        [[nodiscard]] constexpr bool less(bigint<bits, signedness> const &a, bigint<bits, signedness> const &b) noexcept {
+            using limb_type = typename bigint<bits, signedness>::limb_type;
+            auto x = detail::limb_access::limbs(a);
+            auto y = detail::limb_access::limbs(b);
+            if constexpr (signedness == Signedness::Signed) {
+                // Flipping the sign bits maps the signed order onto the unsigned one.
+                constexpr auto sign = static_cast<limb_type>(limb_type{1} << (bigint<bits, signedness>::limb_bits - 1));
+                x.back() ^= sign;
+                y.back() ^= sign;
+            }
+            return (detail::less_mask(x, y) & 1) != 0;
+        }
+
+        template<BitWidth bits, Signedness signedness>
+        [[nodiscard]] constexpr std::strong_ordering compare(bigint<bits, signedness> const &a,
+                                                             bigint<bits, signedness> const &b) noexcept {
+            return static_cast<int>(less(b, a)) - static_cast<int>(less(a, b)) <=> 0;
+        }
+
+        // Quotient and remainder truncated towards zero like operator/ and operator%, by restoring binary long
+        // division that always runs through every bit of the dividend. Throws for a zero divisor.
+        template<BitWidth bits, Signedness signedness>
+        [[nodiscard]] constexpr divmod_result<bigint<bits, signedness> > divmod(bigint<bits, signedness> const &dividend,
+                                                                                 bigint<bits, signedness> const &divisor) {
+            using value_type = bigint<bits, signedness>;
+            using limb_type = typename value_type::limb_type;
+            constexpr auto limb_bits = value_type::limb_bits;
+            if (equal(divisor, value_type{})) {
+                throw std::overflow_error("Division by zero");
+            }
+
+            auto quotient = value_type{};
+            auto remainder = value_type{};
+            auto &q = detail::limb_access::limbs(quotient);
+            auto &r = detail::limb_access::limbs(remainder);
+            auto x = detail::limb_access::limbs(dividend);
+            auto d = detail::limb_access::limbs(divisor);
+            auto dividend_sign = limb_type{0};
+            auto divisor_sign = limb_type{0};
+            if constexpr (signedness == Signedness::Signed) {
+                dividend_sign = detail::bit_mask(static_cast<limb_type>(x.back() >> (limb_bits - 1)));
+                divisor_sign = detail::bit_mask(static_cast<limb_type>(d.back() >> (limb_bits - 1)));
+                detail::conditional_negate(x, dividend_sign);
+                detail::conditional_negate(d, divisor_sign);
+            }
+
+            for (auto i = std::to_underlying(bits); i > 0; --i) {
+                // r = 2 r + next bit, the bit shifted out of the top is kept so r may exceed the width by one bit.
+                auto top = static_cast<limb_type>(x[(i - 1) / limb_bits] >> ((i - 1) % limb_bits) & 1);
+                for (auto &limb: r) {
+                    auto const shifted_out = static_cast<limb_type>(limb >> (limb_bits - 1));
+                    limb = static_cast<limb_type>(limb << 1 | top);
+                    top = shifted_out;
                 }
-            } else {
-                auto const index = std::size_t{data_.size() - 1 - byte_index};
-                if (value) {
-                    data_[index] |= static_cast<std::uint8_t>(1U << bit_index);
-                } else {
-                    data_[index] &= static_cast<std::uint8_t>(~(1U << bit_index));
+                auto difference = r;
+                auto borrow = limb_type{0};
+                for (auto j = 0uz; j < r.size(); ++j) {
+                    difference[j] = detail::sub_borrow(difference[j], d[j], borrow, borrow);
                 }
+                // r >= d if the subtraction did not borrow or r had outgrown the width.
+                auto const take = detail::bit_mask(static_cast<limb_type>((borrow ^ 1) | top));
+                for (auto j = 0uz; j < r.size(); ++j) {
+                    r[j] = static_cast<limb_type>(r[j] ^ (take & (r[j] ^ difference[j])));
+                }
+                q[(i - 1) / limb_bits] |= static_cast<limb_type>((take & 1) << ((i - 1) % limb_bits));
             }
+
+            detail::conditional_negate(q, static_cast<limb_type>(dividend_sign ^ divisor_sign));
+            detail::conditional_negate(r, dividend_sign);
+            return {quotient, remainder};
         }
+    }
 
-        constexpr void multiply_by(std::uint32_t const multiplier) {
-            auto carry = std::uint32_t{0};
-            if constexpr (std::endian::native == std::endian::little) {
-                for (auto const i: std::views::iota(0uz, data_.size())) {
-                    auto const prod = std::uint32_t{static_cast<std::uint32_t>(data_[i]) * multiplier + carry};
-                    data_[i] = static_cast<std::uint8_t>(prod & 0xFF);
-                    carry = prod >> 8;
-                }
-            } else {
-                for (auto const i: std::views::reverse(std::views::iota(1uz, data_.size() + 1))) {
-                    auto const idx = std::size_t{i - 1};
-                    auto const prod = std::uint32_t{static_cast<std::uint32_t>(data_[idx]) * multiplier + carry};
-                    data_[idx] = static_cast<std::uint8_t>(prod & 0xFF);
-                    carry = prod >> 8;
+    namespace detail {
+        // |value| as an unsigned value of the same width, which also covers the minimum of a signed type.
+        template<BitWidth bits, Signedness signedness>
+        [[nodiscard]] constexpr bigint<bits, Signedness::Unsigned> unsigned_magnitude(
+            bigint<bits, signedness> const &value) noexcept {
+            using limb_type = typename bigint<bits, signedness>::limb_type;
+            auto result = bigint<bits, Signedness::Unsigned>{value};
+            if constexpr (signedness == Signedness::Signed) {
+                if (value < std::int8_t{0}) {
+                    conditional_negate(limb_access::limbs(result), static_cast<limb_type>(~limb_type{0}));
                 }
             }
-            if (carry != 0) {
-                throw std::overflow_error("Overflow during multiplication");
+            return result;
+        }
+
+        // The 64 bits of limbs from bit shift on, bits beyond the top read as zero.
+        template<std::unsigned_integral limb_type, std::size_t n>
+        [[nodiscard]] constexpr std::uint64_t bits_at(std::array<limb_type, n> const &limbs,
+                                                      std::size_t const shift) noexcept {
+            constexpr auto limb_bits = std::size_t{sizeof(limb_type) * CHAR_BIT};
+            auto result = std::uint64_t{0};
+            for (auto i = shift / limb_bits; i < n and i * limb_bits < shift + 64; ++i) {
+                auto const position = i * limb_bits;
+                result |= position >= shift ? std::uint64_t{limbs[i]} << (position - shift) : std::uint64_t{limbs[i]} >> (shift - position);
             }
+            return result;
         }
 
-        constexpr void add_value(std::uint8_t const value) {
-            auto carry = std::uint16_t{value};
-            if constexpr (std::endian::native == std::endian::little) {
-                for (auto i = 0uz; i < data_.size() and carry; ++i) {
-                    auto const sum = static_cast<std::uint16_t>(static_cast<std::uint16_t>(data_[i]) + carry);
-                    data_[i] = static_cast<std::uint8_t>(sum & 0xFF);
-                    carry = sum >> 8;
-                }
-            } else {
-                for (auto i = data_.size(); i > 0uz and carry; --i) {
-                    auto const idx = std::size_t{i - 1};
-                    auto const sum = static_cast<std::uint16_t>(static_cast<std::uint16_t>(data_[idx]) + carry);
-                    data_[idx] = static_cast<std::uint8_t>(sum & 0xFF);
-                    carry = sum >> 8;
-                }
+        // r = u x + v y, which has to fit n limbs.
+        template<std::size_t n>
+        constexpr void multiply_add_words(std::array<std::uint64_t, n> &r, std::array<std::uint64_t, n> const &x,
+                                          std::uint64_t const u, std::array<std::uint64_t, n> const &y,
+                                          std::uint64_t const v) noexcept {
+            auto x_carry = std::uint64_t{0};
+            auto y_carry = std::uint64_t{0};
+            auto carry = std::uint64_t{0};
+            for (auto i = 0uz; i < n; ++i) {
+                auto overflow = std::uint64_t{0};
+                auto const xu = mul_wide(x[i], u);
+                auto const xu_low = add_carry(xu.low, x_carry, std::uint64_t{0}, overflow);
+                x_carry = xu.high + overflow;
+                auto const yv = mul_wide(y[i], v);
+                auto const yv_low = add_carry(yv.low, y_carry, std::uint64_t{0}, overflow);
+                y_carry = yv.high + overflow;
+                r[i] = add_carry(xu_low, yv_low, carry, carry);
             }
-            if (carry != 0) {
-                throw std::overflow_error("Overflow during addition");
+        }
+
+        // r = u x - v y, which must not be negative.
+        template<std::size_t n>
+        constexpr void multiply_sub_words(std::array<std::uint64_t, n> &r, std::array<std::uint64_t, n> const &x,
+                                          std::uint64_t const u, std::array<std::uint64_t, n> const &y,
+                                          std::uint64_t const v) noexcept {
+            auto x_carry = std::uint64_t{0};
+            auto y_carry = std::uint64_t{0};
+            auto borrow = std::uint64_t{0};
+            for (auto i = 0uz; i < n; ++i) {
+                auto overflow = std::uint64_t{0};
+                auto const xu = mul_wide(x[i], u);
+                auto const xu_low = add_carry(xu.low, x_carry, std::uint64_t{0}, overflow);
+                x_carry = xu.high + overflow;
+                auto const yv = mul_wide(y[i], v);
+                auto const yv_low = add_carry(yv.low, y_carry, std::uint64_t{0}, overflow);
+                y_carry = yv.high + overflow;
+                r[i] = sub_borrow(xu_low, yv_low, borrow, borrow);
             }
         }
 
-        constexpr void init_from_string_base(std::string_view const str, std::uint32_t const base) {
-            data_.fill(0);
-            for (auto const c: str) {
-                if (c == '\'' or c == ' ') {
+        template<typename value_type>
+        struct lehmer_result {
+            value_type gcd;
+            value_type coefficient;
+            bool negative;
+        };
+
+        // gcd(a, b) and the coefficient x of a in a x + b y = gcd(a, b) with Lehmer's algorithm (Knuth, TAOCP vol. 2,
+        // 4.5.2, algorithm L). The Euclidean quotients are simulated on the leading 62 bits of both remainders as long
+        // as they are certain, and the whole run of steps is then applied to the full values as one 2 x 2 matrix of
+        // single words. Only when not even one quotient is certain does a full division step follow. The cosequence
+        // of coefficients alternates in sign, so only magnitudes and the parity of the step count are kept, and only
+        // if asked for. The value type needs 64 bit limbs and one limb more than the operands.
+        template<bool with_coefficient, typename value_type>
+        [[nodiscard]] constexpr lehmer_result<value_type> lehmer_gcd(value_type r0, value_type r1) {
+            auto s0 = value_type{std::uint8_t{1}};
+            auto s1 = value_type{};
+            auto odd = false;
+            if (r0 < r1) {
+                // A first quotient of zero only swaps the remainders.
+                std::swap(r0, r1);
+                std::swap(s0, s1);
+                odd = true;
+            }
+            auto next_r = value_type{};
+            auto next_s = value_type{};
+            while (r1 != std::uint8_t{0}) {
+                auto const length = significant_bits(limb_access::limbs(r0));
+                auto const shift = length > 62 ? length - 62 : 0uz;
+                auto x = static_cast<std::int64_t>(bits_at(limb_access::limbs(r0), shift));
+                auto y = static_cast<std::int64_t>(bits_at(limb_access::limbs(r1), shift));
+                auto a = std::int64_t{1};
+                auto b = std::int64_t{0};
+                auto c = std::int64_t{0};
+                auto d = std::int64_t{1};
+                auto steps = 0uz;
+                while (y + c > 0 and y + d > 0) {
+                    auto const q = (x + a) / (y + c);
+                    if (q != (x + b) / (y + d)) {
+                        break;
+                    }
+                    auto t = a - q * c;
+                    a = c;
+                    c = t;
+                    t = b - q * d;
+                    b = d;
+                    d = t;
+                    t = x - q * y;
+                    x = y;
+                    y = t;
+                    ++steps;
+                }
+
+                if (b == 0) {
+                    auto const [q, r] = divmod(r0, r1);
+                    r0 = r1;
+                    r1 = r;
+                    if constexpr (with_coefficient) {
+                        next_s = s0 + q * s1;
+                        s0 = s1;
+                        s1 = next_s;
+                        odd = not odd;
+                    }
                     continue;
                 }
-                std::uint8_t digit = 0;
-                if (c >= '0' and c <= '9') {
-                    digit = c - '0';
-                } else if (c >= 'a' and c <= 'f') {
-                    digit = 10 + (c - 'a');
-                } else if (c >= 'A' and c <= 'F') {
-                    digit = 10 + (c - 'A');
+
+                // a and d share a sign, b and c have the other one, so each new remainder is a difference and each
+                // new coefficient a sum of magnitudes.
+                auto const magnitude = [](std::int64_t const value) {
+                    return static_cast<std::uint64_t>(value < 0 ? -value : value);
+                };
+                auto &r0_limbs = limb_access::limbs(r0);
+                auto &r1_limbs = limb_access::limbs(r1);
+                auto &next_limbs = limb_access::limbs(next_r);
+                if (a > 0) {
+                    multiply_sub_words(next_limbs, r0_limbs, magnitude(a), r1_limbs, magnitude(b));
                 } else {
-                    throw std::runtime_error("Invalid digit in input string.");
+                    multiply_sub_words(next_limbs, r1_limbs, magnitude(b), r0_limbs, magnitude(a));
                 }
-                if (digit >= base) {
-                    throw std::runtime_error("Digit out of range for base.");
+                if (c > 0) {
+                    multiply_sub_words(r1_limbs, r0_limbs, magnitude(c), r1_limbs, magnitude(d));
+                } else {
+                    multiply_sub_words(r1_limbs, r1_limbs, magnitude(d), r0_limbs, magnitude(c));
+                }
+                r0_limbs = next_limbs;
+                if constexpr (with_coefficient) {
+                    auto &s0_limbs = limb_access::limbs(s0);
+                    auto &s1_limbs = limb_access::limbs(s1);
+                    multiply_add_words(limb_access::limbs(next_s), s0_limbs, magnitude(a), s1_limbs, magnitude(b));
+                    multiply_add_words(s1_limbs, s0_limbs, magnitude(c), s1_limbs, magnitude(d));
+                    s0 = next_s;
+                    odd = odd != (steps % 2 == 1);
                 }
-                multiply_by(base);
-                add_value(digit);
             }
+            return {r0, s0, odd};
         }
 
-        template<std::size_t max_size, Signedness other_signedness>
-        constexpr bool spaceship_check_index(std::array<std::uint8_t, max_size> lhs_extended,
-                                             std::array<std::uint8_t, max_size> rhs_extended,
-                                             std::size_t const i, std::strong_ordering &value) const {
-            if constexpr (signedness == Signedness::Unsigned and other_signedness == Signedness::Unsigned) {
-                auto const a = lhs_extended[i];
-                auto const b = rhs_extended[i];
-                if (a < b) {
-                    value = std::strong_ordering::less;
-                    return true;
+        // Work type of lehmer_gcd for operands of the given width: 64 bit limbs and one spare limb.
+        template<BitWidth bits>
+        using lehmer_type = bigint<BitWidth{(std::to_underlying(bits) + 63) / 64 * 64 + 64}, Signedness::Unsigned>;
+    }
+
+    // The greatest common divisor of |a| and |b| with Lehmer's algorithm. gcd(0, 0) is 0.
+    template<BitWidth bits, Signedness signedness>
+    [[nodiscard]] constexpr bigint<bits, signedness> gcd(bigint<bits, signedness> const &a,
+                                                         bigint<bits, signedness> const &b) {
+        auto const result = detail::lehmer_gcd<false>(detail::lehmer_type<bits>{detail::unsigned_magnitude(a)},
+                                                      detail::lehmer_type<bits>{detail::unsigned_magnitude(b)});
+        return bigint<bits, signedness>{detail::limb_access::truncate<bigint<bits, Signedness::Unsigned> >(result.gcd)};
+    }
+
+    // The least common multiple of |a| and |b|, 0 if either is 0. Like operator*, it wraps if it does not fit.
+    template<BitWidth bits, Signedness signedness>
+    [[nodiscard]] constexpr bigint<bits, signedness> lcm(bigint<bits, signedness> const &a,
+                                                         bigint<bits, signedness> const &b) {
+        auto const x = detail::unsigned_magnitude(a);
+        auto const y = detail::unsigned_magnitude(b);
+        if (x == std::uint8_t{0} or y == std::uint8_t{0}) {
+            return {};
+        }
+        return bigint<bits, signedness>{x / detail::unsigned_magnitude(gcd(a, b)) * y};
+    }
+
+    // g = gcd(a, b) together with coefficients where a x + b y = g. These are the ones of the extended Euclidean
+    // algorithm, |x| <= |b| / (2 g) and |y| <= |a| / (2 g) unless one operand divides the other, so they always fit
+    // a signed value of the operand width.
+    template<BitWidth bits, Signedness signedness>
+    [[nodiscard]] constexpr extended_gcd_result<bigint<bits, signedness>, bigint<bits, Signedness::Signed> >
+    extended_gcd(bigint<bits, signedness> const &a, bigint<bits, signedness> const &b) {
+        using magnitude_type = bigint<bits, Signedness::Unsigned>;
+        using coefficient_type = bigint<bits, Signedness::Signed>;
+        using wide_type = bigint<BitWidth{2 * std::to_underlying(bits)}, Signedness::Signed>;
+        auto const x_magnitude = detail::unsigned_magnitude(a);
+        auto const y_magnitude = detail::unsigned_magnitude(b);
+        auto const [g, s, negative] = detail::lehmer_gcd<true>(detail::lehmer_type<bits>{x_magnitude},
+                                                         detail::lehmer_type<bits>{y_magnitude});
+        auto const divisor = detail::limb_access::truncate<magnitude_type>(g);
+        auto x = detail::limb_access::truncate<coefficient_type>(s);
+        if (negative) {
+            x = -x;
+        }
+        // The other coefficient follows from a x + b y = g, the division is exact.
+        auto y = coefficient_type{};
+        if (y_magnitude != std::uint8_t{0}) {
+            y = detail::limb_access::truncate<coefficient_type>(
+                (wide_type{divisor} - widening_mul(x_magnitude, x)) / wide_type{y_magnitude});
+        }
+        if (a < std::int8_t{0}) {
+            x = -x;
+        }
+        if (b < std::int8_t{0}) {
+            y = -y;
+        }
+        return {bigint<bits, signedness>{divisor}, x, y};
+    }
+
+    // The inverse of a modulo m in [0, m), with Lehmer's extended Euclidean algorithm. Throws if a and m are not
+    // coprime.
+    template<BitWidth bits, Signedness signedness>
+    [[nodiscard]] constexpr bigint<bits, signedness> mod_inverse(bigint<bits, signedness> const &a,
+                                                                 bigint<bits, signedness> const &modulus) {
+        if (modulus == std::int8_t{0}) {
+            throw std::overflow_error("Division by zero");
+        }
+        if (modulus < std::int8_t{0}) {
+            throw std::invalid_argument("The modulus must be positive.");
+        }
+        auto reduced = a % modulus;
+        if (reduced < std::int8_t{0}) {
+            reduced += modulus;
+        }
+        auto const m = bigint<bits, Signedness::Unsigned>{modulus};
+        auto const [g, s, negative] = detail::lehmer_gcd<true>(detail::lehmer_type<bits>{bigint<bits, Signedness::Unsigned>{reduced}},
+                                                         detail::lehmer_type<bits>{m});
+        if (g != std::uint8_t{1}) {
+            throw std::invalid_argument("The value has no inverse modulo the modulus.");
+        }
+        auto inverse = detail::limb_access::truncate<bigint<bits, Signedness::Unsigned> >(s);
+        if (negative and inverse != std::uint8_t{0}) {
+            inverse = m - inverse;
+        }
+        return bigint<bits, signedness>{inverse};
+    }
+
+    namespace ct {
+        // The inverse of a modulo an odd m in [0, m) in constant time, with the division steps of Bernstein and Yang
+        // ("Fast constant-time gcd computation and modular inversion"). Each step halves g after either adding f,
+        // or replacing (f, g) by (g, (g - f) / 2) when delta is positive, and d and e follow f and g modulo m. The
+        // fixed number of steps is their bound for operands of this width, after which f = +-1 and +-d is the
+        // inverse. Only an even modulus and a value that is not invertible are revealed, by throwing.
+        template<BitWidth bits>
+        [[nodiscard]] constexpr bigint<bits, Signedness::Unsigned> mod_inverse(bigint<bits, Signedness::Unsigned> const &a,
+                                                                               bigint<bits, Signedness::Unsigned> const &modulus) {
+            using value_type = bigint<bits, Signedness::Unsigned>;
+            using limb_type = typename value_type::limb_type;
+            constexpr auto n = value_type::limb_count;
+            constexpr auto limb_bits = value_type::limb_bits;
+            auto const &m = detail::limb_access::limbs(modulus);
+            if ((m[0] & 1) == 0) {
+                throw std::invalid_argument("The constant-time inverse needs an odd modulus.");
+            }
+
+            // f and g as two's complement values with one spare limb, d and e in [0, m).
+            auto f = std::array<limb_type, n + 1>{};
+            auto g = std::array<limb_type, n + 1>{};
+            std::ranges::copy(m, f.begin());
+            std::ranges::copy(detail::limb_access::limbs(ct::divmod(a, modulus).remainder), g.begin());
+            auto d = std::array<limb_type, n>{};
+            auto e = std::array<limb_type, n>{};
+            e[0] = 1;
+            auto delta = std::int64_t{1};
+
+            // x mod m for x < 2 m, carry is the bit above the top limb of x.
+            auto const reduce_once = [&m](std::array<limb_type, n> &x, limb_type const carry) {
+                auto difference = x;
+                auto const borrow = detail::sub_limbs(difference, m);
+                auto const take = detail::bit_mask(static_cast<limb_type>(carry | (borrow ^ 1)));
+                for (auto i = 0uz; i < n; ++i) {
+                    x[i] = static_cast<limb_type>(x[i] ^ (take & (x[i] ^ difference[i])));
                 }
-                if (a > b) {
-                    value = std::strong_ordering::greater;
-                    return true;
+            };
+
+            constexpr auto steps = (49 * std::to_underlying(bits) + 80) / 17;
+            for (auto step = 0uz; step < steps; ++step) {
+                auto const positive = detail::bit_mask(static_cast<limb_type>(static_cast<std::uint64_t>(-delta) >> 63));
+                auto const odd = detail::bit_mask(static_cast<limb_type>(g[0] & 1));
+                auto const swap = static_cast<limb_type>(positive & odd);
+                auto const swap_sign = static_cast<std::int64_t>(static_cast<std::int64_t>(swap & 1) * -1);
+                delta = (delta ^ swap_sign) - swap_sign + 1;
+
+                // (f, g, d, e) = (g, -f, e, -d) if swapping.
+                for (auto i = 0uz; i <= n; ++i) {
+                    auto const difference = static_cast<limb_type>(swap & (f[i] ^ g[i]));
+                    f[i] ^= difference;
+                    g[i] ^= difference;
                 }
-            } else if constexpr (signedness == Signedness::Unsigned and signedness == Signedness::Signed) {
-                auto const a = lhs_extended[i];
-                auto const b = static_cast<std::int8_t>(rhs_extended[i]);
-                if (a < b) {
-                    value = std::strong_ordering::less;
-                    return true;
+                for (auto i = 0uz; i < n; ++i) {
+                    auto const difference = static_cast<limb_type>(swap & (d[i] ^ e[i]));
+                    d[i] ^= difference;
+                    e[i] ^= difference;
                 }
-                if (a > b) {
-                    value = std::strong_ordering::greater;
-                    return true;
+                detail::conditional_negate(g, swap);
+                auto negated = m;
+                static_cast<void>(detail::sub_limbs(negated, e));
+                for (auto i = 0uz; i < n; ++i) {
+                    e[i] = static_cast<limb_type>(e[i] ^ (swap & (e[i] ^ negated[i])));
                 }
-            } else if constexpr (signedness == Signedness::Signed and other_signedness == Signedness::Unsigned) {
-                auto const a = static_cast<std::int8_t>(lhs_extended[i]);
-                auto const b = rhs_extended[i];
-                if (a < b) {
-                    value = std::strong_ordering::less;
-                    return true;
+                reduce_once(e, limb_type{0});
+
+                // g = (g + f) / 2 and e = (e + d) / 2 mod m if g is odd, otherwise plain halvings.
+                auto carry = limb_type{0};
+                for (auto i = 0uz; i <= n; ++i) {
+                    g[i] = detail::add_carry(g[i], static_cast<limb_type>(f[i] & odd), carry, carry);
                 }
-                if (a > b) {
-                    value = std::strong_ordering::greater;
-                    return true;
+                for (auto i = 0uz; i < n; ++i) {
+                    g[i] = static_cast<limb_type>(g[i] >> 1 | g[i + 1] << (limb_bits - 1));
                 }
-            } else {
-                auto const a = static_cast<std::int8_t>(lhs_extended[i]);
-                auto const b = static_cast<std::int8_t>(rhs_extended[i]);
-                if (a < b) {
-                    value = std::strong_ordering::less;
-                    return true;
+                g[n] = static_cast<limb_type>(g[n] >> 1 | (g[n] & static_cast<limb_type>(limb_type{1} << (limb_bits - 1))));
+
+                carry = limb_type{0};
+                for (auto i = 0uz; i < n; ++i) {
+                    e[i] = detail::add_carry(e[i], static_cast<limb_type>(d[i] & odd), carry, carry);
                 }
-                if (a > b) {
-                    value = std::strong_ordering::greater;
-                    return true;
+                reduce_once(e, carry);
+                auto const e_odd = detail::bit_mask(static_cast<limb_type>(e[0] & 1));
+                carry = limb_type{0};
+                for (auto i = 0uz; i < n; ++i) {
+                    e[i] = detail::add_carry(e[i], static_cast<limb_type>(m[i] & e_odd), carry, carry);
+                }
+                for (auto i = 0uz; i + 1 < n; ++i) {
+                    e[i] = static_cast<limb_type>(e[i] >> 1 | e[i + 1] << (limb_bits - 1));
                 }
+                e[n - 1] = static_cast<limb_type>(e[n - 1] >> 1 | carry << (limb_bits - 1));
             }
-            return false;
-        }
-    };
 
-#ifndef bigint_DISABLE_IO
-    template<BitWidth bits, Signedness signedness>
-    constexpr std::ostream &print_hex(std::ostream &os, bigint<bits, signedness> const &data, bool const use_uppercase) {
-        auto const &buf = data.data_;
-        auto start = buf.size();
-        while (start > 1 and buf[start - 1] == 0) {
-            --start;
-        }
-
-        if constexpr (std::endian::native == std::endian::little) {
-            for (auto const i: std::views::reverse(std::views::iota(0uz, start))) {
-                auto local = std::array<char, 3>{};
-                std::snprintf(
-                    local.data(),
-                    local.size(),
-                    use_uppercase ? "%02X" : "%02x",
-                    buf[i]
-                );
-                os.write(local.data(), local.size() - 1);
+            // f = +-gcd(a, m) now, the inverse exists if that is +-1.
+            auto const negative = detail::bit_mask(static_cast<limb_type>(f[n] >> (limb_bits - 1)));
+            detail::conditional_negate(f, negative);
+            f[0] ^= 1;
+            if ((detail::zero_mask(f) & 1) == 0) {
+                throw std::invalid_argument("The value has no inverse modulo the modulus.");
             }
-        } else {
-            for (auto const i: std::views::iota(0uz, start)) {
-                auto local = std::array<char, 3>{};
-                std::snprintf(
-                    local.data(),
-                    local.size(),
-                    use_uppercase ? "%02X" : "%02x",
-                    buf[i]
-                );
-                os.write(local.data(), local.size() - 1);
+            auto result = value_type{};
+            auto &r = detail::limb_access::limbs(result);
+            auto negated = m;
+            static_cast<void>(detail::sub_limbs(negated, d));
+            for (auto i = 0uz; i < n; ++i) {
+                r[i] = static_cast<limb_type>(d[i] ^ (negative & (d[i] ^ negated[i])));
             }
+            reduce_once(r, limb_type{0});
+            return result;
         }
-
-        return os;
     }
 
-    template<BitWidth bits, Signedness signedness>
-    constexpr std::ostream &print_oct(std::ostream &os, bigint<bits, signedness> const &data) {
-        auto temp = data;
-
-        if (temp == std::int8_t{0}) {
-            os.put('0');
-            return os;
+    namespace detail {
+        // An upper bound of floor(value^(1 / n)) for value > 0 and n >= 2, where Newton's iteration starts. At run
+        // time it is 2^(log2(value) / n) from a double approximation of the leading 64 bits, raised by 2^-20 so that
+        // rounding can only make it larger, which leaves about 40 correct bits. Constant evaluation has no <cmath>
+        // and starts from 2^ceil(bit_width / n).
+        template<BitWidth bits>
+        [[nodiscard]] constexpr bigint<bits, Signedness::Unsigned> root_seed(
+            bigint<bits, Signedness::Unsigned> const &value, std::size_t const n) {
+            using value_type = bigint<bits, Signedness::Unsigned>;
+            auto const width = static_cast<std::size_t>(bit_width(value));
+            if !consteval {
+                auto const shift = width > 64 ? width - 64 : 0uz;
+                auto const log = std::log2(static_cast<double>(bits_at(limb_access::limbs(value), shift))) +
+                                 static_cast<double>(shift);
+                auto const root_log = log / static_cast<double>(n);
+                auto const exponent = root_log > 52.0 ? static_cast<std::size_t>(root_log) - 52 : 0uz;
+                auto const mantissa = std::exp2(root_log - static_cast<double>(exponent)) * (1.0 + 0x1p-20);
+                auto seed = value_type{};
+                add_word(limb_access::limbs(seed), static_cast<std::uint64_t>(mantissa) + 2);
+                return seed << exponent;
+            }
+            return value_type{std::uint8_t{1}} << ((width + n - 1) / n);
         }
 
-        constexpr auto max_oct_digits = std::size_t{(std::to_underlying(bits) / 3) + 2};
-        auto buffer = std::array<char, max_oct_digits>{};
-        auto pos = buffer.end();
-
-        while (temp != std::int8_t{0}) {
-            auto r = temp % std::int8_t{8};
-            auto digit = r.data_[0];
-            *--pos = static_cast<char>('0' + digit);
-            temp /= std::int8_t{8};
+        // min(base^exponent, limit + 1) for base >= 1, where limit + 1 has to fit. A product whose factors together have
+        // more bits than limit + 1 is known to exceed it without being formed, so no product gets wider than two bits
+        // over limit.
+        template<BitWidth bits>
+        [[nodiscard]] constexpr bigint<bits, Signedness::Unsigned> bounded_power(
+            bigint<bits, Signedness::Unsigned> const &base, std::size_t exponent,
+            bigint<bits, Signedness::Unsigned> const &limit) {
+            using value_type = bigint<bits, Signedness::Unsigned>;
+            auto const cap = limit + std::uint8_t{1};
+            auto const cap_width = bit_width(cap);
+            auto const bounded_product = [&](value_type const &a, value_type const &b) {
+                if (bit_width(a) + bit_width(b) - 2 >= cap_width) {
+                    return cap;
+                }
+                auto const product = a * b;
+                return product < cap ? product : cap;
+            };
+
+            auto result = value_type{std::uint8_t{1}};
+            auto power = base;
+            while (true) {
+                if (exponent % 2 != 0) {
+                    result = bounded_product(result, power);
+                }
+                exponent /= 2;
+                if (exponent == 0) {
+                    return result;
+                }
+                power = bounded_product(power, power);
+            }
         }
-
-        auto const length = static_cast<std::size_t>(buffer.end() - pos);
-        os.write(std::to_address(pos), length);
-        return os;
     }
 
+    // floor(sqrt(value)) by Newton's iteration from root_seed, which decreases monotonically to the root. Every step
+    // costs one division and doubles the correct bits, so a 512 bit value takes three steps and a fourth that finds
+    // the iteration has stopped. Throws std::invalid_argument for negative values.
     template<BitWidth bits, Signedness signedness>
-    constexpr std::ostream &print_dec(std::ostream &os, bigint<bits, signedness> const &data) {
-        auto temp = data;
-
-        if (temp == std::int8_t{0}) {
-            os.put('0');
-            return os;
+    [[nodiscard]] constexpr bigint<bits, signedness> isqrt(bigint<bits, signedness> const &value) {
+        if (value < std::int8_t{0}) {
+            throw std::invalid_argument("Root of a negative value.");
         }
-
-        auto negative = false;
-        if constexpr (signedness == Signedness::Signed) {
-            if (temp < std::int8_t{0}) {
-                negative = true;
-                temp = -temp;
+        if (value <= std::uint8_t{1}) {
+            return value;
+        }
+        auto const x = detail::unsigned_magnitude(value);
+        auto root = detail::root_seed(x, 2);
+        while (true) {
+            auto next = (root + x / root) >> 1;
+            if (next >= root) {
+                return bigint<bits, signedness>{root};
             }
+            root = next;
         }
+    }
 
-        constexpr auto max_dec_digits = std::size_t{static_cast<std::size_t>(std::to_underlying(bits) * 0.3010299957) + 3}; //std::log10(2)
-        auto buffer = std::array<char, max_dec_digits>{};
-        auto pos = buffer.end();
-
-        while (temp != std::int8_t{0}) {
-            auto r = temp % std::int8_t{10};
-            auto digit = r.data_[0];
-            *--pos = static_cast<char>('0' + digit);
-            temp /= std::int8_t{10};
+    // floor(value^(1 / n)) by Newton's iteration r' = ((n - 1) r + value / r^(n - 1)) / n. The iteration runs one limb
+    // wider than value, and r^(n - 1) stops growing once it exceeds value, where the quotient is zero anyway. Throws
+    // std::invalid_argument for n = 0 and for negative values.
+    template<BitWidth bits, Signedness signedness>
+    [[nodiscard]] constexpr bigint<bits, signedness> iroot(bigint<bits, signedness> const &value, std::size_t const n) {
+        if (n == 0) {
+            throw std::invalid_argument("Zeroth root.");
         }
-
-        if (negative) {
-            os.put('-');
+        if (value < std::int8_t{0}) {
+            throw std::invalid_argument("Root of a negative value.");
+        }
+        if (n == 1 or value <= std::uint8_t{1}) {
+            return value;
+        }
+        if (n == 2) {
+            return isqrt(value);
+        }
+        auto const x = detail::unsigned_magnitude(value);
+        if (n >= static_cast<std::size_t>(bit_width(x))) {
+            // value < 2^n, so the root is below two.
+            return bigint<bits, signedness>{std::uint8_t{1}};
         }
 
-        auto const length = static_cast<std::size_t>(buffer.end() - pos);
-        os.write(std::to_address(pos), length);
-        return os;
+        using wide_type = bigint<BitWidth{std::to_underlying(bits) + 64}, Signedness::Unsigned>;
+        auto const wide = wide_type{x};
+        auto root = wide_type{detail::root_seed(x, n)};
+        while (true) {
+            auto next = root * (n - 1) + wide / detail::bounded_power(root, n - 1, wide);
+            next /= n;
+            if (next >= root) {
+                return detail::limb_access::truncate<bigint<bits, signedness> >(root);
+            }
+            root = next;
+        }
     }
 
+    // floor(log2(value)), one less than the bit width of value. Throws std::invalid_argument unless value > 0.
     template<BitWidth bits, Signedness signedness>
-    constexpr std::ostream &operator<<(std::ostream &os, bigint<bits, signedness> const &data) {
-        auto const flags = os.flags();
-        auto const base_flag = flags & std::ios_base::basefield;
-        auto const use_uppercase = (flags & std::ios_base::uppercase) != 0;
-
-        switch (base_flag) {
-            case std::ios_base::hex:
-                print_hex(os, data, use_uppercase);
-                break;
-            case std::ios_base::oct:
-                print_oct(os, data);
-                break;
-            case std::ios_base::dec:
-            default:
-                print_dec(os, data);
-                break;
+    [[nodiscard]] constexpr int ilog2(bigint<bits, signedness> const &value) {
+        if (value <= std::int8_t{0}) {
+            throw std::invalid_argument("Logarithm of a non-positive value.");
         }
-
-        return os;
+        return bit_width(detail::unsigned_magnitude(value)) - 1;
     }
 
-    template<BitWidth bits, Signedness signedness>
-    constexpr std::istream &operator>>(std::istream &is, bigint<bits, signedness> &data) {
-        auto token = std::string{};
-        if (!(is >> token)) {
-            return is;
+    // floor(log_base(value)). Powers of two take the bit width. Otherwise the power of base just below the double
+    // estimate (bit_width - 1) / log2(base) is formed by squaring, and multiplying by base corrects it upwards in a
+    // step or two. Throws std::invalid_argument unless value > 0 and base >= 2.
+    template<BitWidth bits, Signedness signedness, std::integral T>
+    [[nodiscard]] constexpr int ilog(bigint<bits, signedness> const &value, T const base) {
+        if (value <= std::int8_t{0}) {
+            throw std::invalid_argument("Logarithm of a non-positive value.");
         }
-
-        auto const flags = is.flags();
-        auto const base_flag = flags & std::ios_base::basefield;
-        auto base = std::uint8_t{10};
-        if (base_flag == std::ios_base::hex) {
-            base = 16;
-        } else if (base_flag == std::ios_base::oct) {
-            base = 8;
+        if (base < 2) {
+            throw std::invalid_argument("Logarithm base below two.");
         }
-        try {
-            if (base != 10) {
-                if (!token.empty() and token[0] == '-') {
-                    throw std::runtime_error("Negative sign not allowed for non-decimal input");
+        using value_type = bigint<bits, Signedness::Unsigned>;
+        auto const x = detail::unsigned_magnitude(value);
+        auto const word = static_cast<std::uint64_t>(base);
+        if (std::has_single_bit(word)) {
+            return (bit_width(x) - 1) / std::countr_zero(word);
+        }
+        if (std::bit_width(word) > std::to_underlying(bits)) {
+            return 0;
+        }
+
+        auto multiplier = value_type{};
+        detail::add_word(detail::limb_access::limbs(multiplier), word);
+        auto exponent = 0;
+        auto power = value_type{std::uint8_t{1}};
+        if !consteval {
+            auto const estimate = static_cast<int>(static_cast<double>(bit_width(x) - 1) /
+                                                   std::log2(static_cast<double>(word))) - 1;
+            // base^estimate <= value, and so is every square on the way, since the last one is not taken.
+            exponent = estimate > 0 ? estimate : 0;
+            auto square = multiplier;
+            for (auto remaining = exponent; remaining != 0;) {
+                if (remaining % 2 != 0) {
+                    power *= square;
+                }
+                remaining /= 2;
+                if (remaining != 0) {
+                    square *= square;
                 }
-                data = bigint<bits, signedness>();
-                data.init_from_string_base(token, base);
-            } else {
-                data = token;
             }
-        } catch (std::exception const &) {
-            is.setstate(std::ios::failbit);
         }
-        return is;
+        // power * base <= x exactly when power <= floor(x / base).
+        auto const limit = x / multiplier;
+        while (power <= limit) {
+            detail::multiply_word(detail::limb_access::limbs(power), word);
+            ++exponent;
+        }
+        return exponent;
     }
-#endif
 
     template<BitWidth bits, Signedness signedness>
-    constexpr bigint<bits, signedness> byteswap(bigint<bits, signedness> const &data) {
-        auto result = bigint<bits, signedness>{data};
-        std::ranges::reverse(result.data_);
-        return result;
+    [[nodiscard]] constexpr int ilog10(bigint<bits, signedness> const &value) {
+        return ilog(value, 10);
     }
 
     template<BitWidth bits, Signedness signedness>
@@ -1175,4 +4738,232 @@ namespace bigint {
             return result;
         }
     }
+
+    namespace detail {
+        // Splits an integer literal spelled like a C++ one into its base and digits: 0x and 0b prefixes, a leading
+        // zero for octal and ' separators.
+        struct literal_digits {
+            std::string_view digits;
+            std::uint8_t base;
+
+            constexpr explicit literal_digits(std::string_view const text) noexcept : digits{text}, base{10} {
+                if (text.size() > 1 and text[0] == '0') {
+                    switch (text[1]) {
+                        case 'x':
+                        case 'X':
+                            base = 16;
+                            digits = text.substr(2);
+                            break;
+                        case 'b':
+                        case 'B':
+                            base = 2;
+                            digits = text.substr(2);
+                            break;
+                        default:
+                            base = 8;
+                            digits = text.substr(1);
+                            break;
+                    }
+                }
+            }
+
+            // Upper bound for the number of bits the value needs.
+            [[nodiscard]] constexpr std::size_t bit_count() const noexcept {
+                auto count = 0uz;
+                auto leading = true;
+                for (auto const c: digits) {
+                    if (c == '\'' or (leading and c == '0')) {
+                        continue;
+                    }
+                    leading = false;
+                    ++count;
+                }
+                if (base == 10) {
+                    // log2(10) < 3.3219281
+                    return (count * 33219281 + 9999999) / 10000000;
+                }
+                return count * static_cast<std::size_t>(std::countr_zero(base));
+            }
+        };
+
+        template<char... chars>
+        inline constexpr std::array<char, sizeof...(chars)> literal_text{chars...};
+
+        template<char... chars>
+        inline constexpr literal_digits literal{std::string_view{literal_text<chars...>.data(), sizeof...(chars)}};
+
+        template<BitWidth bits, Signedness signedness, char... chars>
+        consteval bigint<bits, signedness> parse_literal() {
+            constexpr auto &text = literal<chars...>;
+            auto result = bigint<bits, Signedness::Unsigned>{};
+            auto &limbs = limb_access::limbs(result);
+            auto const first = text.digits.data();
+            if (parse_digits(limbs, first, first + text.digits.size(), text.base, true) != parse_status::ok) {
+                throw std::overflow_error("Literal does not fit the bigint type.");
+            }
+            if constexpr (signedness == Signedness::Signed) {
+                if ((limbs.back() >> (result.limb_bits - 1)) != 0) {
+                    throw std::overflow_error("Literal does not fit the bigint type.");
+                }
+            }
+            return bigint<bits, signedness>{result};
+        }
+
+        // Smallest multiple of 64 bits that holds the literal, with room for a sign bit when signed. The digit count
+        // gives a first estimate that is narrowed down by parsing the literal once.
+        template<Signedness signedness, char... chars>
+        inline constexpr BitWidth literal_width = [] {
+            constexpr auto round_up = [](std::size_t const bit_count) {
+                return BitWidth{std::max(std::size_t{64}, (bit_count + 63) / 64 * 64)};
+            };
+            auto const value = parse_literal<round_up(literal<chars...>.bit_count()), Signedness::Unsigned, chars...>();
+            return round_up(significant_bits(limb_access::limbs(value)) + (signedness == Signedness::Signed));
+        }();
+    }
+
+    // Integer literals evaluated at compile time, e.g. 0xFFFF'FFFF_u256 or 123_i512. _ubig and _ibig pick the
+    // smallest multiple of 64 bits that holds the literal. A literal that does not fit fails to compile.
+    namespace literals {
+#define bigint_DEFINE_LITERAL(width) \
+        template<char... chars> \
+        consteval bigint<BitWidth{width}, Signedness::Unsigned> operator""_u##width() { \
+            return detail::parse_literal<BitWidth{width}, Signedness::Unsigned, chars...>(); \
+        } \
+        template<char... chars> \
+        consteval bigint<BitWidth{width}, Signedness::Signed> operator""_i##width() { \
+            return detail::parse_literal<BitWidth{width}, Signedness::Signed, chars...>(); \
+        }
+
+        bigint_DEFINE_LITERAL(128)
+        bigint_DEFINE_LITERAL(256)
+        bigint_DEFINE_LITERAL(512)
+        bigint_DEFINE_LITERAL(1024)
+        bigint_DEFINE_LITERAL(2048)
+        bigint_DEFINE_LITERAL(4096)
+#undef bigint_DEFINE_LITERAL
+
+        template<char... chars>
+        consteval auto operator""_ubig() {
+            constexpr auto width = detail::literal_width<Signedness::Unsigned, chars...>;
+            return detail::parse_literal<width, Signedness::Unsigned, chars...>();
+        }
+
+        template<char... chars>
+        consteval auto operator""_ibig() {
+            constexpr auto width = detail::literal_width<Signedness::Signed, chars...>;
+            return detail::parse_literal<width, Signedness::Signed, chars...>();
+        }
+    }
 }
+
+#if not defined(bigint_DISABLE_IO) and defined(__cpp_lib_format)
+// Formats a bigint like a built-in integer: [[fill]align][sign][#][0][width][type] with the types d, x, X, o, b
+// and B. Nested replacement fields for the width and non-ASCII fill characters are not supported.
+template<bigint::BitWidth bits, bigint::Signedness signedness>
+struct std::formatter<bigint::bigint<bits, signedness>, char> {
+    constexpr std::format_parse_context::iterator parse(std::format_parse_context &ctx) {
+        auto it = ctx.begin();
+        auto const end = ctx.end();
+        auto const is_align = [](char const c) {
+            return c == '<' or c == '>' or c == '^';
+        };
+
+        if (it != end and std::next(it) != end and is_align(*std::next(it)) and *it != '{' and *it != '}') {
+            fill_ = *it;
+            align_ = *std::next(it);
+            it += 2;
+        } else if (it != end and is_align(*it)) {
+            align_ = *it++;
+        }
+        if (it != end and (*it == '+' or *it == '-' or *it == ' ')) {
+            sign_ = *it++;
+        }
+        if (it != end and *it == '#') {
+            alternate_ = true;
+            ++it;
+        }
+        if (it != end and *it == '0') {
+            zero_pad_ = true;
+            ++it;
+        }
+        while (it != end and *it >= '0' and *it <= '9') {
+            width_ = width_ * 10 + static_cast<std::size_t>(*it++ - '0');
+        }
+        if (it != end and *it != '}') {
+            switch (*it) {
+                case 'd':
+                case 'x':
+                case 'X':
+                case 'o':
+                case 'b':
+                case 'B':
+                    type_ = *it++;
+                    break;
+                default:
+                    throw std::format_error("Invalid format specifier for bigint.");
+            }
+        }
+        if (it != end and *it != '}') {
+            throw std::format_error("Invalid format specifier for bigint.");
+        }
+        return it;
+    }
+
+    template<typename FormatContext>
+    auto format(bigint::bigint<bits, signedness> const &value, FormatContext &ctx) const -> decltype(ctx.out()) {
+        // Room for a sign and a two character prefix in front of the binary digits and their own sign.
+        constexpr auto max_length = std::size_t{std::to_underlying(bits) + 4};
+        auto buffer = std::array<char, max_length>{};
+        auto const base = type_ == 'x' or type_ == 'X' ? 16 : type_ == 'o' ? 8 : type_ == 'b' or type_ == 'B' ? 2 : 10;
+        auto const last = bigint::to_chars(buffer.data() + 3, buffer.data() + buffer.size(), value, base).ptr;
+
+        auto digits = buffer.data() + 3;
+        auto const negative = *digits == '-';
+        if (negative) {
+            ++digits;
+        }
+        if (type_ == 'X') {
+            std::ranges::transform(digits, last, digits, [](char const c) {
+                return c >= 'a' and c <= 'f' ? static_cast<char>(c - 'a' + 'A') : c;
+            });
+        }
+
+        auto prefix = digits;
+        if (alternate_) {
+            if (base == 16 or base == 2) {
+                *--prefix = type_;
+                *--prefix = '0';
+            } else if (base == 8 and not(last - digits == 1 and *digits == '0')) {
+                *--prefix = '0';
+            }
+        }
+        if (negative) {
+            *--prefix = '-';
+        } else if (sign_ == '+' or sign_ == ' ') {
+            *--prefix = sign_;
+        }
+
+        auto const length = static_cast<std::size_t>(last - prefix);
+        auto const padding = width_ > length ? width_ - length : 0;
+        auto out = ctx.out();
+        if (align_ == '\0' and zero_pad_) {
+            out = std::copy(prefix, digits, out);
+            out = std::fill_n(out, padding, '0');
+            return std::copy(digits, last, out);
+        }
+        auto const before = align_ == '<' ? 0 : align_ == '^' ? padding / 2 : padding;
+        out = std::fill_n(out, before, fill_);
+        out = std::copy(prefix, last, out);
+        return std::fill_n(out, padding - before, fill_);
+    }
+
+private:
+    char fill_{' '};
+    char align_{'\0'};
+    char sign_{'-'};
+    bool alternate_{false};
+    bool zero_pad_{false};
+    std::size_t width_{0};
+    char type_{'d'};
+};
+#endif
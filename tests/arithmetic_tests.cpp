@@ -2,10 +2,95 @@
 // Created by Rene Windegger on 21/03/2025.
 //
 
+#include "test_values.hpp"
+
 #include <bigint23/bigint.hpp>
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <limits>
+#include <vector>
+
 namespace {
+    // The mixed operators against the same operation with the integral converted to a bigint first.
+    template<bigint::BitWidth bits, bigint::Signedness signedness, typename T>
+    void check_mixed(bigint::bigint<bits, signedness> const &x, T const t) {
+        using value_type = bigint::bigint<bits, signedness>;
+        auto const operand = value_type{t};
+        ASSERT_EQ(x + t, x + operand);
+        ASSERT_EQ(x - t, x - operand);
+        ASSERT_EQ(x * t, x * operand);
+        if (t != 0) {
+            ASSERT_EQ(x / t, x / operand);
+            ASSERT_EQ(x % t, x % operand);
+        }
+        if constexpr (std::is_signed_v<T> == (signedness == bigint::Signedness::Signed)) {
+            ASSERT_EQ(x <=> t, x <=> operand);
+            ASSERT_EQ(x == t, x == operand);
+        }
+    }
+
+    template<bigint::BitWidth bits, bigint::Signedness signedness, typename T>
+    void check_mixed_type() {
+        using value_type = bigint::bigint<bits, signedness>;
+        if constexpr (sizeof(T) * CHAR_BIT <= std::to_underlying(bits)) {
+            auto values = std::vector<value_type>{value_type{std::uint8_t{0}}, value_type{std::uint8_t{1}},
+                                                  value_type{std::uint8_t{7}}, ~value_type{std::uint8_t{0}}};
+            values.push_back(~value_type{std::uint8_t{0}} >> 1);
+            values.push_back(~(~value_type{std::uint8_t{0}} >> 1));
+            values.push_back(value_type{std::numeric_limits<T>::max()});
+            values.push_back(value_type{std::numeric_limits<T>::min()});
+            auto const mixed = value_type{test_values::make_value<std::to_underlying(bits)>(1)};
+            values.push_back(mixed);
+            values.push_back(mixed >> (std::to_underlying(bits) / 2));
+
+            auto const operands = {T{0}, T{1}, static_cast<T>(-1), T{7}, static_cast<T>(100),
+                                   std::numeric_limits<T>::min(), std::numeric_limits<T>::max(),
+                                   static_cast<T>(std::numeric_limits<T>::max() / 3)};
+            for (auto const &x: values) {
+                for (auto const t: operands) {
+                    check_mixed(x, t);
+                }
+            }
+        }
+    }
+
+    // Every shift of x against repeated doubling and halving rounded towards negative infinity.
+    template<bigint::BitWidth bits, bigint::Signedness signedness>
+    void check_shifts(bigint::bigint<bits, signedness> const &x) {
+        auto doubled = x;
+        auto halved = x;
+        for (auto shift = 0uz; shift <= std::to_underlying(bits) + 1; ++shift) {
+            ASSERT_EQ(x << shift, doubled) << shift;
+            ASSERT_EQ(x >> shift, halved) << shift;
+            auto shifted = x;
+            shifted <<= shift;
+            ASSERT_EQ(shifted, doubled) << shift;
+            shifted = x;
+            shifted >>= shift;
+            ASSERT_EQ(shifted, halved) << shift;
+            auto const two = std::uint8_t{2};
+            auto const round_down = halved % two != std::uint8_t{0} and halved < std::int8_t{0};
+            doubled *= two;
+            halved /= two;
+            if (round_down) {
+                halved -= std::uint8_t{1};
+            }
+        }
+    }
+
+    template<bigint::BitWidth bits, bigint::Signedness signedness>
+    void check_mixed_width() {
+        check_mixed_type<bits, signedness, std::int8_t>();
+        check_mixed_type<bits, signedness, std::uint8_t>();
+        check_mixed_type<bits, signedness, std::int16_t>();
+        check_mixed_type<bits, signedness, std::uint16_t>();
+        check_mixed_type<bits, signedness, std::int32_t>();
+        check_mixed_type<bits, signedness, std::uint32_t>();
+        check_mixed_type<bits, signedness, std::int64_t>();
+        check_mixed_type<bits, signedness, std::uint64_t>();
+    }
+
     TEST(bigint23, addition_with_integral_test) {
         using i32 = bigint::bigint<bigint::BitWidth{32}, bigint::Signedness::Signed>;
         using u32 = bigint::bigint<bigint::BitWidth{32}, bigint::Signedness::Unsigned>;
@@ -200,4 +285,213 @@ namespace {
         constexpr i8 a = "42";
         ASSERT_EQ(+a, static_cast<int8_t>(42));
     }
+
+    TEST(bigint23, limb_carry_propagation_test) {
+        using u256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+        using i96 = bigint::bigint<bigint::BitWidth{96}, bigint::Signedness::Signed>;
+        using u24 = bigint::bigint<bigint::BitWidth{24}, bigint::Signedness::Unsigned>;
+        static_assert(std::is_same_v<u256::limb_type, std::uint64_t>);
+        static_assert(std::is_same_v<i96::limb_type, std::uint32_t>);
+        static_assert(std::is_same_v<u24::limb_type, std::uint8_t>);
+
+        u256 const a = "0xffffffffffffffffffffffffffffffff";
+        u256 const b = "0x100000000000000000000000000000000";
+        ASSERT_EQ(a + 1, b);
+        ASSERT_EQ(b - 1, a);
+        ASSERT_EQ(a * a, u256{"0xfffffffffffffffffffffffffffffffe00000000000000000000000000000001"});
+        ASSERT_EQ(b / a, 1);
+        ASSERT_EQ(b % a, 1);
+        i96 const c = "-39614081257132168796771975167";
+        ASSERT_EQ(c - 1, i96{"0x800000000000000000000000"});
+        ASSERT_EQ(c * -1, i96{"39614081257132168796771975167"});
+        u24 const d = "0xfffffe";
+        ASSERT_EQ(d + static_cast<std::uint8_t>(2), static_cast<std::uint8_t>(0));
+        ASSERT_EQ(d * static_cast<std::uint8_t>(3), u24{"0xfffffa"});
+    }
+
+    TEST(bigint23, constexpr_carry_chain_test) {
+        using u256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+        constexpr u256 a = "0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff";
+        constexpr auto b = a + static_cast<std::uint8_t>(1);
+        static_assert(b == static_cast<std::uint8_t>(0));
+        constexpr auto c = b - static_cast<std::uint8_t>(1);
+        static_assert(c == a);
+        ASSERT_EQ(b, 0);
+        ASSERT_EQ(c, a);
+    }
+
+    TEST(bigint23, multi_limb_division_test) {
+        using u512 = bigint::bigint<bigint::BitWidth{512}, bigint::Signedness::Unsigned>;
+        using i512 = bigint::bigint<bigint::BitWidth{512}, bigint::Signedness::Signed>;
+        u512 const a = "0x9f3c6d1e5b7a2c4e8d0f1a3b5c7d9e2f4a6b8c0d1e2f3a4b5c6d7e8f9a0b1c2d3e4f5a6b7c8d9e0f1a2b3c4d5e6f7a8b9c0d1e2f3a4b5c6d7e8f9a0b1c2d";
+        u512 const b = "0xe1d2c3b4a5968778695a4b3c2d1e0f00112233445566778899";
+        ASSERT_EQ(a / b, u512{"0xb483c3bbc94ed9b9b79b7f46e8a63ca0c19d0ef708741aea67d899556fa85c82f33815e987"});
+        ASSERT_EQ(a % b, u512{"0x3ea66a63ece14002eaba0b7973e9670cf0eaf6d2591921d27e"});
+        ASSERT_EQ(b / a, 0);
+        ASSERT_EQ(b % a, b);
+        i512 const c = -i512{a};
+        ASSERT_EQ(c / i512{b}, -i512{a / b});
+        ASSERT_EQ(c % i512{b}, -i512{a % b});
+        constexpr u512 d = "0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffe";
+        constexpr u512 e = "0xffffffffffffffffffffffffffffffff";
+        static_assert(d / e == u512{"0x100000000000000000000000000000000"});
+        static_assert(d % e == u512{"0xfffffffffffffffffffffffffffffffe"});
+    }
+
+    TEST(bigint23, wide_multiplication_test) {
+        using u8192 = bigint::bigint<bigint::BitWidth{8192}, bigint::Signedness::Unsigned>;
+        using i8192 = bigint::bigint<bigint::BitWidth{8192}, bigint::Signedness::Signed>;
+        auto const one = u8192{std::uint8_t{1}};
+        auto const a = (one << 4000) - 1;
+        ASSERT_EQ(a * a, (one << 8000) - (one << 4001) + 1);
+        ASSERT_EQ(a * ~u8192{}, -a);
+
+        auto const b = test_values::make_value<8192>(1);
+        auto const c = b >> 4100;
+        auto const d = (b << 4100) >> 4100;
+        ASSERT_EQ((c + d) * (c + d), c * c + c * d * 2 + d * d);
+        ASSERT_EQ(i8192{c} * -i8192{d}, -i8192{c * d});
+        ASSERT_EQ(c * d / d, c);
+    }
+
+    TEST(bigint23, ntt_multiplication_test) {
+        using u131072 = bigint::bigint<bigint::BitWidth{131072}, bigint::Signedness::Unsigned>;
+        auto const one = u131072{std::uint8_t{1}};
+        auto const a = (one << 60000) - 1;
+        ASSERT_EQ(a * a, (one << 120000) - (one << 60001) + 1);
+        ASSERT_EQ(~u131072{} * ~u131072{}, one);
+
+        auto const b = test_values::make_value<131072>(1);
+        auto const c = b >> 65600;
+        auto const d = (b << 65600) >> 65600;
+        ASSERT_EQ((c + d) * (c + d), c * c + c * d * 2 + d * d);
+        ASSERT_EQ(square(b), b * u131072{b});
+        using u262144 = bigint::bigint<bigint::BitWidth{262144}, bigint::Signedness::Unsigned>;
+        ASSERT_EQ(widening_mul(b, c), u262144{b} * u262144{c});
+        ASSERT_EQ(c * d / d, c);
+    }
+
+    TEST(bigint23, square_test) {
+        using u128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Unsigned>;
+        using i128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Signed>;
+        using u8192 = bigint::bigint<bigint::BitWidth{8192}, bigint::Signedness::Unsigned>;
+        ASSERT_EQ(square(u128{0xFFFFFFFFFFFFFFFFULL}), u128{"0xFFFFFFFFFFFFFFFE0000000000000001"});
+        ASSERT_EQ(square(i128{-12345}), i128{152399025});
+        ASSERT_EQ(square(~u128{}), u128{std::uint8_t{1}});
+
+        auto const b = test_values::make_value<8192>(1);
+        auto const copy = b;
+        ASSERT_EQ(square(b), b * copy);
+        ASSERT_EQ(b * b, b * copy);
+        auto const c = b >> 4096;
+        ASSERT_EQ(square(c), c * u8192{c});
+        auto d = b;
+        d *= d;
+        ASSERT_EQ(d, b * copy);
+    }
+
+    TEST(bigint23, widening_mul_test) {
+        using u64 = bigint::bigint<bigint::BitWidth{64}, bigint::Signedness::Unsigned>;
+        using i64 = bigint::bigint<bigint::BitWidth{64}, bigint::Signedness::Signed>;
+        using u96 = bigint::bigint<bigint::BitWidth{96}, bigint::Signedness::Unsigned>;
+        using u128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Unsigned>;
+        using i128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Signed>;
+        using u192 = bigint::bigint<bigint::BitWidth{192}, bigint::Signedness::Unsigned>;
+        using u256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+        using u512 = bigint::bigint<bigint::BitWidth{512}, bigint::Signedness::Unsigned>;
+        using u16384 = bigint::bigint<bigint::BitWidth{16384}, bigint::Signedness::Unsigned>;
+
+        auto const max = ~u256{};
+        static_assert(std::is_same_v<decltype(widening_mul(max, max)), u512>);
+        auto const one = u512{std::uint8_t{1}};
+        ASSERT_EQ(widening_mul(max, max), (one << 512) - (one << 257) + 1);
+        ASSERT_EQ(mul_hi(max, max), max - 1);
+        ASSERT_EQ(mul_hi(u64{0xFFFFFFFFFFFFFFFFULL}, u64{0xFFFFFFFFFFFFFFFFULL}), 0xFFFFFFFFFFFFFFFEULL);
+
+        auto const product = widening_mul(i64{-3}, u128{"0x10000000000000000"});
+        static_assert(std::is_same_v<decltype(product), bigint::bigint<bigint::BitWidth{192}, bigint::Signedness::Signed> const>);
+        ASSERT_EQ(product, -(bigint::bigint<bigint::BitWidth{192}, bigint::Signedness::Signed>{3} << 64));
+        ASSERT_EQ(widening_mul(i128{-1}, i128{-1}), 1);
+        ASSERT_EQ(mul_hi(i64{-2}, i64{3}), -1);
+
+        u96 const a = "0xFFFFFFFF00000001FFFFFFFF";
+        ASSERT_EQ(widening_mul(a, a), u192{a} * u192{a});
+        constexpr auto b = widening_mul(u128{"0xFEDCBA98765432100123456789ABCDEF"}, u64{0x1234567890ABCDEFULL});
+        static_assert(b == u192{"0xFEDCBA98765432100123456789ABCDEF"} * u192{0x1234567890ABCDEFULL});
+
+        auto const c = test_values::make_value<8192>(1);
+        auto const d = ~c;
+        ASSERT_EQ(widening_mul(c, d), u16384{c} * u16384{d});
+        ASSERT_EQ(widening_mul(c, c), square(u16384{c}));
+        ASSERT_EQ(u16384{mul_hi(c, d)}, (u16384{c} * u16384{d}) >> 8192);
+    }
+
+    TEST(bigint23, mixed_integral_operand_test) {
+        using u256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+        using i256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Signed>;
+
+        check_mixed_width<bigint::BitWidth{16}, bigint::Signedness::Unsigned>();
+        check_mixed_width<bigint::BitWidth{16}, bigint::Signedness::Signed>();
+        check_mixed_width<bigint::BitWidth{24}, bigint::Signedness::Unsigned>();
+        check_mixed_width<bigint::BitWidth{24}, bigint::Signedness::Signed>();
+        check_mixed_width<bigint::BitWidth{64}, bigint::Signedness::Unsigned>();
+        check_mixed_width<bigint::BitWidth{64}, bigint::Signedness::Signed>();
+        check_mixed_width<bigint::BitWidth{96}, bigint::Signedness::Unsigned>();
+        check_mixed_width<bigint::BitWidth{96}, bigint::Signedness::Signed>();
+        check_mixed_width<bigint::BitWidth{256}, bigint::Signedness::Unsigned>();
+        check_mixed_width<bigint::BitWidth{256}, bigint::Signedness::Signed>();
+
+        auto balance = u256{"0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF"};
+        balance += 1;
+        ASSERT_EQ(balance, u256{"0x100000000000000000000000000000000"});
+        balance -= 1;
+        ASSERT_EQ(balance, u256{"0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF"});
+        balance += -1;
+        ASSERT_EQ(balance, u256{"0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFE"});
+        ASSERT_EQ(i256{"-123456789012345678901234567890"} % 1000, -890);
+        ASSERT_EQ(i256{"-123456789012345678901234567890"} / -1000, i256{"123456789012345678901234567"});
+        ASSERT_LT(i256{-1}, 0);
+        ASSERT_GT(i256{-1}, 0u);
+        ASSERT_NE(u256{std::numeric_limits<std::uint64_t>::max()}, -1);
+        ASSERT_THROW(static_cast<void>(u256{1} / 0), std::overflow_error);
+        ASSERT_THROW(static_cast<void>(i256{1} % 0), std::overflow_error);
+
+        constexpr auto counter = [] {
+            auto value = u256{"0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF"};
+            value += 1;
+            value *= 1000;
+            value /= 7;
+            return value % 1000;
+        }();
+        static_assert(counter == (((u256{"0x1000000000000000000000000000000000000000000000000"} * u256{1000}) / u256{7}) %
+                                  u256{1000}));
+    }
+
+    TEST(bigint23, shift_kernel_test) {
+        using u24 = bigint::bigint<bigint::BitWidth{24}, bigint::Signedness::Unsigned>;
+        using i24 = bigint::bigint<bigint::BitWidth{24}, bigint::Signedness::Signed>;
+        using u96 = bigint::bigint<bigint::BitWidth{96}, bigint::Signedness::Unsigned>;
+        using i96 = bigint::bigint<bigint::BitWidth{96}, bigint::Signedness::Signed>;
+        using u256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+        using i256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Signed>;
+
+        check_shifts(u24{"0xA5C381"});
+        check_shifts(-i24{"0x25C381"});
+        check_shifts(u96{"0xFEDCBA9876543210F0E1D2C3"});
+        check_shifts(-i96{"0x7EDCBA9876543210F0E1D2C3"});
+        check_shifts(u256{"0x8000000000000001FEDCBA98765432100123456789ABCDEF00000000FFFFFFFF"});
+        check_shifts(-i256{"0x7000000000000001FEDCBA98765432100123456789ABCDEF00000000FFFFFFFF"});
+        check_shifts(i256{"0x7000000000000001FEDCBA98765432100123456789ABCDEF00000000FFFFFFFF"});
+        check_shifts(i256{-1});
+
+        constexpr auto shifted = [] {
+            auto value = u256{"0x123456789ABCDEF0"};
+            value <<= 1;
+            value <<= 64;
+            value <<= 67;
+            value >>= 128;
+            return value;
+        }();
+        static_assert(shifted == u256{"0x123456789ABCDEF00"});
+    }
 }
@@ -190,4 +190,44 @@ namespace {
         ak = std::string("1234");
         ASSERT_EQ(ak, 1234);
     }
+
+    TEST(bigint23, string_parsing_test) {
+        using u320 = bigint::bigint<bigint::BitWidth{320}, bigint::Signedness::Unsigned>;
+        using u24 = bigint::bigint<bigint::BitWidth{24}, bigint::Signedness::Unsigned>;
+
+        u320 const a = "12345678901234567890123456789012345678901234567890123456789012345678901234567890";
+        ASSERT_EQ(a, u320{"0x6a9e8ea23cb63c228f31ad9268b4097f156d6aa11dcb29f14baccff196ce3f0ad2"});
+        ASSERT_EQ(a, u320{"03251721650436266170212171432662232132011376125553252043562624761227263177431331617605322"});
+        ASSERT_EQ(a, u320{"0x6a9e'8ea2 3cb63c22'8f31ad92'68b4097f'156d6aa1'1dcb29f1'4baccff1'96ce3f0a'd2"});
+        ASSERT_EQ(u320{"0b100100011010001010110011110001001101010111100110111101111"}, u320{"0x0123456789abcdef"});
+        ASSERT_EQ(u24{"0xffffff"}, u24{"16777215"});
+
+        ASSERT_THROW(static_cast<void>(u24{"0x1000000"}), std::overflow_error);
+        ASSERT_THROW(static_cast<void>(u24{"16777216"}), std::overflow_error);
+        ASSERT_THROW(static_cast<void>(u24{"0x12g4"}), std::runtime_error);
+        ASSERT_THROW(static_cast<void>(u24{"12a4"}), std::runtime_error);
+        ASSERT_THROW(static_cast<void>(u24{"0b102"}), std::runtime_error);
+    }
+
+    TEST(bigint23, user_defined_literal_test) {
+        using namespace bigint::literals;
+        using u128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Unsigned>;
+        using i256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Signed>;
+
+        constexpr auto a = 0xFFFF'FFFF'FFFF'FFFF'FFFF'FFFF'FFFF'FFFF_u128;
+        static_assert(std::is_same_v<decltype(a), u128 const>);
+        ASSERT_EQ(a, ~u128{});
+
+        constexpr auto b = -12345678901234567890123456789012345678901234567890_i256;
+        ASSERT_EQ(b, -i256{"12345678901234567890123456789012345678901234567890"});
+        ASSERT_EQ(0b1010_i256 + 017_i256, 25);
+
+        constexpr auto c = 18446744073709551615_ubig;
+        constexpr auto d = 18446744073709551616_ubig;
+        constexpr auto e = 9223372036854775807_ibig;
+        static_assert(decltype(c)::limb_count == 1);
+        static_assert(decltype(d)::limb_count == 2);
+        static_assert(decltype(e)::limb_count == 1);
+        ASSERT_EQ(d - c, 1);
+    }
 }
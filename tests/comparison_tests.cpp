@@ -2,9 +2,14 @@
 // Created by Rene Windegger on 22/03/2025.
 //
 
+#include "test_values.hpp"
+
 #include <bigint23/bigint.hpp>
 #include <gtest/gtest.h>
 
+#include <compare>
+#include <cstdint>
+
 namespace {
     TEST(bigint23, compare_8bit_test) {
         using uint128_t = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Unsigned>;
@@ -52,10 +57,10 @@ namespace {
         uint128_t const b = static_cast<uint64_t>(0x43);
         ASSERT_LT(a, b);
         ASSERT_GT(b, a);
-        int128_t const c = static_cast<int64_t>(0xD6);
+        int128_t const c = static_cast<int8_t>(0xD6);
         ASSERT_GT(a, c);
         ASSERT_LT(c, a);
-        int128_t const d = static_cast<int64_t>(0xD7);
+        int128_t const d = static_cast<int8_t>(0xD7);
         ASSERT_GT(d, c);
         ASSERT_LT(c, d);
         int128_t const e = -124592;
@@ -64,4 +69,43 @@ namespace {
         ASSERT_GT(f, a);
         ASSERT_LT(a, f);
     }
-}
\ No newline at end of file
+
+    TEST(bigint23, compare_limbs_test) {
+        using u96 = bigint::bigint<bigint::BitWidth{96}, bigint::Signedness::Unsigned>;
+        using i96 = bigint::bigint<bigint::BitWidth{96}, bigint::Signedness::Signed>;
+        using u256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+        using i256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Signed>;
+        using u4096 = bigint::bigint<bigint::BitWidth{4096}, bigint::Signedness::Unsigned>;
+        using i4096 = bigint::bigint<bigint::BitWidth{4096}, bigint::Signedness::Signed>;
+
+        auto const a = test_values::make_value<4096>(1);
+        for (auto const bit: {0uz, 1uz, 63uz, 64uz, 511uz, 512uz, 1000uz, 4031uz, 4095uz}) {
+            auto const b = a ^ (u4096{1} << bit);
+            auto const expected = ((a >> bit) & u4096{1}) == 0 ? std::strong_ordering::less : std::strong_ordering::greater;
+            ASSERT_EQ(a <=> b, expected) << bit;
+            ASSERT_EQ(b <=> a, 0 <=> expected) << bit;
+            ASSERT_NE(a, b);
+        }
+        ASSERT_EQ(a <=> u4096{a}, std::strong_ordering::equal);
+        ASSERT_LT(-i4096{a >> 1}, i4096{a >> 1});
+        ASSERT_LT(-i4096{a >> 1}, -i4096{a >> 2});
+
+        u96 const b = "0xFFFFFFFF0000000000000001";
+        i96 const c = -1;
+        ASSERT_LT(u256{b}, u256{"0x1000000000000000000000000"});
+        ASSERT_GT(u256{"0x1000000000000000000000000"}, b);
+        ASSERT_LT(b, u256{"0x1000000000000000000000000"});
+        ASSERT_EQ(b <=> u256{b}, std::strong_ordering::equal);
+        ASSERT_LT(c, u256{});
+        ASSERT_GT(u256{}, c);
+        ASSERT_EQ(c <=> i256{-1}, std::strong_ordering::equal);
+        ASSERT_LT(c, i256{1});
+        ASSERT_GT(c, i256{-2});
+        ASSERT_LT(-i256{"0x1000000000000000000000000"}, c);
+        ASSERT_GT(b, c);
+
+        static_assert(u256{"0x8000000000000000000000000000000000000000000000000000000000000000"} > u256{1});
+        static_assert(i256{-5} < u96{3});
+        static_assert((u96{7} <=> i256{7}) == std::strong_ordering::equal);
+    }
+}
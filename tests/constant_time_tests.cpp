@@ -0,0 +1,80 @@
+//
+// Created by Rene Windegger on 16/10/2026.
+//
+
+#include "test_values.hpp"
+
+#include <bigint23/bigint.hpp>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace {
+    template<std::size_t width, bigint::Signedness signedness>
+    using int_t = bigint::bigint<bigint::BitWidth{width}, signedness>;
+
+    template<std::size_t width, bigint::Signedness signedness>
+    std::vector<int_t<width, signedness> > make_values() {
+        using value_type = int_t<width, signedness>;
+        auto values = std::vector{value_type{}, value_type{1}, value_type{2}, value_type{7}, ~value_type{}};
+        if constexpr (signedness == bigint::Signedness::Signed) {
+            values.push_back(value_type{-1} << (width - 1));
+            values.push_back(~(value_type{-1} << (width - 1)));
+            values.push_back(value_type{-7});
+        }
+        for (auto i = 0; i < 12; ++i) {
+            // Spread the magnitudes so both short and full width values show up.
+            values.push_back(value_type{test_values::make_value<width>(i + 1)} >> (i * width / 12));
+        }
+        return values;
+    }
+
+    template<std::size_t width, bigint::Signedness signedness>
+    void check_constant_time() {
+        auto const values = make_values<width, signedness>();
+        for (auto const &a: values) {
+            ASSERT_EQ(bigint::ct::negate(a), ~a + 1);
+            for (auto const &b: values) {
+                ASSERT_EQ(bigint::ct::add(a, b), a + b);
+                ASSERT_EQ(bigint::ct::sub(a, b), a - b);
+                ASSERT_EQ(bigint::ct::mul(a, b), a * b);
+                ASSERT_EQ(bigint::ct::equal(a, b), a == b);
+                ASSERT_EQ(bigint::ct::less(a, b), a < b);
+                ASSERT_EQ(bigint::ct::compare(a, b), a <=> b);
+                ASSERT_EQ(bigint::ct::select(true, a, b), a);
+                ASSERT_EQ(bigint::ct::select(false, a, b), b);
+                auto x = a;
+                auto y = b;
+                bigint::ct::cswap(false, x, y);
+                ASSERT_EQ(x, a);
+                ASSERT_EQ(y, b);
+                bigint::ct::cswap(true, x, y);
+                ASSERT_EQ(x, b);
+                ASSERT_EQ(y, a);
+                // The quotient of the minimum by -1 overflows, operator/ rejects that.
+                if (b != 0 and (signedness == bigint::Signedness::Unsigned or a != values[5] or b != ~int_t<width, signedness>{})) {
+                    auto const [quotient, remainder] = bigint::ct::divmod(a, b);
+                    ASSERT_EQ(quotient, a / b);
+                    ASSERT_EQ(remainder, a % b);
+                }
+            }
+        }
+        ASSERT_THROW(static_cast<void>(bigint::ct::divmod(values[1], values[0])), std::overflow_error);
+    }
+}
+
+TEST(bigint23, constant_time_test) {
+    check_constant_time<64, bigint::Signedness::Unsigned>();
+    check_constant_time<64, bigint::Signedness::Signed>();
+    check_constant_time<256, bigint::Signedness::Unsigned>();
+    check_constant_time<256, bigint::Signedness::Signed>();
+    check_constant_time<96, bigint::Signedness::Signed>();
+    check_constant_time<1024, bigint::Signedness::Unsigned>();
+
+    using i128 = int_t<128, bigint::Signedness::Signed>;
+    constexpr auto result = bigint::ct::divmod(i128{-1000003}, i128{97});
+    static_assert(result.quotient == i128{-1000003 / 97});
+    static_assert(result.remainder == i128{-1000003 % 97});
+    static_assert(bigint::ct::less(i128{-5}, i128{3}));
+    static_assert(bigint::ct::select(true, i128{1}, i128{2}) == 1);
+}
@@ -5,6 +5,10 @@
 #include <bigint23/bigint.hpp>
 #include <gtest/gtest.h>
 
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+
 TEST(bigint23, byteswap_test) {
     bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Unsigned> expected;
     if constexpr (std::endian::native == std::endian::little) {
@@ -29,3 +33,235 @@ TEST(bigint23, abs_test) {
     auto actual2 = abs(expected);
     ASSERT_EQ(actual2, expected);
 }
+
+TEST(bigint23, divmod_test) {
+    using u256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+    using i128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Signed>;
+    u256 const a = "0x1234567890abcdef1234567890abcdef1234567890abcdef";
+    u256 const b = "0xfedcba0987654321";
+    auto const [quotient, remainder] = divmod(a, b);
+    ASSERT_EQ(quotient, a / b);
+    ASSERT_EQ(remainder, a % b);
+    ASSERT_EQ(quotient * b + remainder, a);
+
+    i128 const c = -1234567;
+    i128 const d = 1000;
+    auto const signed_result = divmod(c, d);
+    ASSERT_EQ(signed_result.quotient, -1234);
+    ASSERT_EQ(signed_result.remainder, -567);
+    ASSERT_THROW(static_cast<void>(divmod(c, i128{0})), std::overflow_error);
+}
+
+TEST(bigint23, short_divmod_test) {
+    using u24 = bigint::bigint<bigint::BitWidth{24}, bigint::Signedness::Unsigned>;
+    using u256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+    using i128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Signed>;
+    u256 const a = "115792089237316195423570985008687907853269984665640564039457584007913129639935";
+    auto const [quotient, remainder] = divmod(a, 10'000'000'000'000'000'000ULL);
+    static_assert(std::is_same_v<decltype(remainder), u256 const>);
+    ASSERT_EQ(quotient, u256{"11579208923731619542357098500868790785326998466564056403945"});
+    ASSERT_EQ(remainder, 7584007913129639935ULL);
+
+    i128 const b = -1234567;
+    for (auto const divisor: {1000, -1000, 7, -1}) {
+        auto const signed_result = divmod(b, divisor);
+        ASSERT_EQ(signed_result.quotient, b / divisor) << divisor;
+        ASSERT_EQ(signed_result.remainder, b % divisor) << divisor;
+    }
+    ASSERT_EQ(divmod(b, -1000).quotient, 1234);
+    ASSERT_EQ(divmod(b, 1000).remainder, -567);
+    ASSERT_EQ(divmod(b, 1000u).remainder, -567);
+    ASSERT_EQ(divmod(i128{1234567}, -1000).remainder, 567);
+
+    // Divisors that do not fit a limb or the signedness of the dividend take the general path.
+    auto const c = u24{"100000"};
+    ASSERT_EQ(divmod(c, std::uint16_t{1000}).quotient, std::uint16_t{100});
+    ASSERT_EQ(divmod(c, std::uint16_t{1000}).remainder, std::uint16_t{0});
+    ASSERT_EQ(divmod(c, std::uint8_t{7}).remainder, c % std::uint8_t{7});
+    ASSERT_EQ(divmod(a, std::int64_t{-1}).quotient, a / std::int64_t{-1});
+    ASSERT_THROW(static_cast<void>(divmod(b, 0)), std::overflow_error);
+}
+
+TEST(bigint23, rotate_test) {
+    using u16 = bigint::bigint<bigint::BitWidth{16}, bigint::Signedness::Unsigned>;
+    using u64 = bigint::bigint<bigint::BitWidth{64}, bigint::Signedness::Unsigned>;
+    using u96 = bigint::bigint<bigint::BitWidth{96}, bigint::Signedness::Unsigned>;
+    using u256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+    using i256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Signed>;
+
+    auto const word = std::uint64_t{0x8123456789ABCDEFULL};
+    auto const half = std::uint16_t{0x8F01};
+    for (auto shift = -130; shift <= 130; ++shift) {
+        ASSERT_EQ(rotl(u64{word}, shift), std::rotl(word, shift)) << shift;
+        ASSERT_EQ(rotr(u64{word}, shift), std::rotr(word, shift)) << shift;
+        ASSERT_EQ(rotl(u16{half}, shift), std::rotl(half, shift)) << shift;
+        ASSERT_EQ(rotr(u16{half}, shift), std::rotr(half, shift)) << shift;
+    }
+
+    u96 const a = "0x800000000000000000000001";
+    ASSERT_EQ(rotl(a, 1), u96{3});
+    ASSERT_EQ(rotr(a, 1), u96{"0xC00000000000000000000000"});
+    ASSERT_EQ(rotl(a, 96), a);
+    ASSERT_EQ(rotr(a, -1), rotl(a, 1));
+
+    u256 const b = "0x8000000000000001FEDCBA98765432100123456789ABCDEF00000000FFFFFFFF";
+    for (auto shift = 1; shift < 256; ++shift) {
+        ASSERT_EQ(rotl(b, shift), (b << shift) | (b >> (256 - shift))) << shift;
+        ASSERT_EQ(rotr(rotl(b, shift), shift), b) << shift;
+    }
+
+    i256 const c = -2;
+    ASSERT_EQ(rotl(c, 1), -3);
+    ASSERT_EQ(rotr(c, 1), i256{"0x7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF"});
+    static_assert(rotl(u256{1}, -1) == u256{1} << 255);
+}
+
+TEST(bigint23, bit_functions_test) {
+    using u24 = bigint::bigint<bigint::BitWidth{24}, bigint::Signedness::Unsigned>;
+    using u64 = bigint::bigint<bigint::BitWidth{64}, bigint::Signedness::Unsigned>;
+    using u256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+    using i256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Signed>;
+
+    for (auto const word: {std::uint64_t{0}, std::uint64_t{1}, std::uint64_t{2}, std::uint64_t{3},
+                           std::uint64_t{0x8000000000000000ULL}, std::uint64_t{0x8000000000000001ULL},
+                           std::uint64_t{0x00F0000000000000ULL}, std::uint64_t{0x0123456789ABCDEFULL},
+                           ~std::uint64_t{0}}) {
+        auto const value = u64{word};
+        ASSERT_EQ(countl_zero(value), std::countl_zero(word)) << word;
+        ASSERT_EQ(countr_zero(value), std::countr_zero(word)) << word;
+        ASSERT_EQ(countl_one(value), std::countl_one(word)) << word;
+        ASSERT_EQ(countr_one(value), std::countr_one(word)) << word;
+        ASSERT_EQ(popcount(value), std::popcount(word)) << word;
+        ASSERT_EQ(bit_width(value), std::bit_width(word)) << word;
+        ASSERT_EQ(has_single_bit(value), std::has_single_bit(word)) << word;
+        ASSERT_EQ(bit_floor(value), std::bit_floor(word)) << word;
+        if (word <= 0x8000000000000000ULL) {
+            ASSERT_EQ(bit_ceil(value), std::bit_ceil(word)) << word;
+        }
+    }
+
+    auto const a = u256{"0x0000000000000000000000000000000100000000000000000000000000000000"};
+    ASSERT_EQ(countl_zero(a), 127);
+    ASSERT_EQ(countr_zero(a), 128);
+    ASSERT_EQ(popcount(a), 1);
+    ASSERT_EQ(bit_width(a), 129);
+    ASSERT_TRUE(has_single_bit(a));
+    ASSERT_FALSE(has_single_bit(a | u256{1}));
+    ASSERT_EQ(bit_floor(a | u256{1}), a);
+    ASSERT_EQ(bit_ceil(a + std::uint8_t{1}), a << 1);
+    ASSERT_EQ(bit_ceil(a), a);
+    ASSERT_EQ(countl_zero(u256{}), 256);
+    ASSERT_EQ(countr_zero(u256{}), 256);
+    ASSERT_EQ(popcount(~u256{}), 256);
+    ASSERT_EQ(bit_ceil(u256{}), 1);
+    ASSERT_EQ(bit_floor(u256{}), 0);
+    ASSERT_THROW(static_cast<void>(bit_ceil((u256{1} << 255) + std::uint8_t{1})), std::overflow_error);
+
+    auto const b = u24{"0x010F00"};
+    ASSERT_EQ(countl_zero(b), 7);
+    ASSERT_EQ(countr_zero(b), 8);
+    ASSERT_EQ(popcount(b), 5);
+    ASSERT_EQ(bit_ceil(b), u24{"0x020000"});
+
+    auto bitmap = u256{};
+    bitmap.set_bit(0).set_bit(64).set_bit(255);
+    ASSERT_TRUE(bitmap.test_bit(0));
+    ASSERT_TRUE(bitmap.test_bit(64));
+    ASSERT_FALSE(bitmap.test_bit(65));
+    ASSERT_EQ(bitmap, (u256{1} << 255) + (u256{1} << 64) + std::uint8_t{1});
+    bitmap.clear_bit(64).flip_bit(255).flip_bit(100);
+    ASSERT_EQ(bitmap, (u256{1} << 100) + std::uint8_t{1});
+    ASSERT_THROW(static_cast<void>(bitmap.test_bit(256)), std::out_of_range);
+    ASSERT_THROW(bitmap.set_bit(256), std::out_of_range);
+    ASSERT_THROW(bitmap.clear_bit(300), std::out_of_range);
+    ASSERT_THROW(bitmap.flip_bit(~0uz), std::out_of_range);
+    ASSERT_EQ(bitmap, (u256{1} << 100) + std::uint8_t{1});
+
+    auto c = i256{};
+    c.set_bit(255);
+    ASSERT_LT(c, 0);
+    ASSERT_TRUE(i256{-1}.test_bit(200));
+
+    static_assert(bit_width(u256{"0x10000000000000000"}) == 65);
+    static_assert(u256{}.set_bit(70) == u256{1} << 70);
+}
+
+TEST(bigint23, roots_and_logs_test) {
+    using u24 = bigint::bigint<bigint::BitWidth{24}, bigint::Signedness::Unsigned>;
+    using u64 = bigint::bigint<bigint::BitWidth{64}, bigint::Signedness::Unsigned>;
+    using u128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Unsigned>;
+    using u512 = bigint::bigint<bigint::BitWidth{512}, bigint::Signedness::Unsigned>;
+    using i512 = bigint::bigint<bigint::BitWidth{512}, bigint::Signedness::Signed>;
+
+    for (auto word = std::uint64_t{1}; word < 5000; ++word) {
+        auto const value = u64{word};
+        auto root = std::uint64_t{0};
+        while ((root + 1) * (root + 1) <= word) {
+            ++root;
+        }
+        ASSERT_EQ(isqrt(value), root) << word;
+        auto cube = std::uint64_t{0};
+        while ((cube + 1) * (cube + 1) * (cube + 1) <= word) {
+            ++cube;
+        }
+        ASSERT_EQ(iroot(value, 3), cube) << word;
+        ASSERT_EQ(ilog2(value), std::bit_width(word) - 1) << word;
+        auto log = 0;
+        for (auto power = std::uint64_t{10}; power <= word; power *= 10) {
+            ++log;
+        }
+        ASSERT_EQ(ilog10(value), log) << word;
+    }
+    ASSERT_EQ(isqrt(u24{"0xFFFFFF"}), std::uint16_t{4095});
+    ASSERT_EQ(iroot(u24{"0xFFFFFF"}, 3), std::uint16_t{255});
+    ASSERT_EQ(ilog(u24{"0xFFFFFF"}, 3), 15);
+
+    auto const x = u512{"0x1D5A8F3C6E2B9047A13C5E7F9B2D4680F1E3C5A7B9D0F2E4C6A8B0D2F4E6C8A0B1C3D5E7F9A1B3C5D7E9F0A2B4C6D8E0F1A3B5C7D9E0F2A4B6C8D0E1F3A5"};
+    for (auto const n: {2uz, 3uz, 5uz, 7uz, 64uz, 100uz, 200uz}) {
+        auto const root = iroot(x, n);
+        auto power = u512{1};
+        auto next = u512{1};
+        for (auto i = 0uz; i < n; ++i) {
+            power *= root;
+        }
+        for (auto i = 0uz; i < n and next <= x; ++i) {
+            next *= root + std::uint8_t{1};
+        }
+        ASSERT_LE(power, x) << n;
+        ASSERT_GT(next, x) << n;
+    }
+    auto const square = u512{"0xFEDCBA9876543210FEDCBA9876543210FEDCBA9876543210FEDCBA9876543210"};
+    ASSERT_EQ(isqrt(square * square), square);
+    ASSERT_EQ(isqrt(square * square - std::uint8_t{1}), square - std::uint8_t{1});
+    ASSERT_EQ(isqrt(~u512{}), (u512{1} << 256) - std::uint8_t{1});
+    ASSERT_EQ(iroot(x, 600), 1);
+    ASSERT_EQ(iroot(i512{x}, 3), i512{iroot(x, 3)});
+
+    auto power = u512{1};
+    for (auto i = 0; i <= 154; ++i) {
+        ASSERT_EQ(ilog10(power), i);
+        if (i > 0) {
+            ASSERT_EQ(ilog10(power - std::uint8_t{1}), i - 1);
+        }
+        power *= std::uint8_t{10};
+    }
+    ASSERT_EQ(ilog10(~u512{}), 154);
+    ASSERT_EQ(ilog2(~u512{}), 511);
+    ASSERT_EQ(ilog(x, 16), 123);
+    ASSERT_EQ(ilog(x, 7), 175);
+    ASSERT_EQ(ilog(x, ~std::uint64_t{0}), 7);
+
+    ASSERT_EQ(bigint::detail::max_decimal_digits<bigint::BitWidth{128}>, ilog10(~u128{}) + 1);
+    ASSERT_EQ(bigint::detail::max_decimal_digits<bigint::BitWidth{512}>, ilog10(~u512{}) + 1);
+    ASSERT_EQ(bigint::detail::max_decimal_digits<bigint::BitWidth{24}>, ilog10(~u24{}) + 1);
+
+    ASSERT_THROW(static_cast<void>(isqrt(-i512{2})), std::invalid_argument);
+    ASSERT_THROW(static_cast<void>(iroot(x, 0)), std::invalid_argument);
+    ASSERT_THROW(static_cast<void>(ilog2(u512{})), std::invalid_argument);
+    ASSERT_THROW(static_cast<void>(ilog10(-i512{5})), std::invalid_argument);
+    ASSERT_THROW(static_cast<void>(ilog(x, 1)), std::invalid_argument);
+
+    static_assert(isqrt(u128{"0x100000000000000000000"}) == u128{"0x10000000000"});
+    static_assert(iroot(u128{1000000}, 3) == 100);
+    static_assert(ilog10(u128{"0x1000000000000000000000000"}) == 28);
+}
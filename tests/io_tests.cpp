@@ -4,7 +4,10 @@
 
 #include <bigint23/bigint.hpp>
 #include <gtest/gtest.h>
+#include <array>
+#include <charconv>
 #include <sstream>
+#include <string_view>
 
 namespace {
     TEST(bigint23, decimal_positive_os_test) {
@@ -21,6 +24,107 @@ namespace {
         ASSERT_EQ(oss.str(), "-123456789");
     }
 
+    TEST(bigint23, wide_decimal_os_test) {
+        auto const digits = std::string{"31415926535897932384626433832795028841971693993751"};
+        auto expected = std::string{"-"};
+        for (auto i = 0; i < 20; ++i) {
+            expected += digits;
+        }
+        expected += std::string(75, '0') + "1";
+        bigint::bigint<bigint::BitWidth{4096}, bigint::Signedness::Signed> a;
+        std::istringstream iss(expected);
+        iss >> a;
+        std::ostringstream oss;
+        oss << a;
+        ASSERT_EQ(oss.str(), expected);
+    }
+
+    TEST(bigint23, to_chars_test) {
+        using int128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Signed>;
+        auto const a = -int128{"0x1A2B3C4D5E6F7A8B9C"};
+        auto buffer = std::array<char, 140>{};
+        auto const to_string = [&buffer](std::to_chars_result const result) {
+            EXPECT_EQ(result.ec, std::errc{});
+            return std::string_view{buffer.data(), result.ptr};
+        };
+        auto const first = buffer.data();
+        auto const last = buffer.data() + buffer.size();
+        ASSERT_EQ(to_string(to_chars(first, last, -a)), "482730796026674449308");
+        ASSERT_EQ(to_string(to_chars(first, last, a, 16)), "-1a2b3c4d5e6f7a8b9c");
+        ASSERT_EQ(to_string(to_chars(first, last, a, 8)), "-64254742325715736505634");
+        ASSERT_EQ(to_string(to_chars(first, last, a, 36)), "-2tvk8pnqvj1wv0");
+        ASSERT_EQ(to_string(to_chars(first, last, int128{0}, 2)), "0");
+
+        auto const too_small = to_chars(first, first + 20, a);
+        ASSERT_EQ(too_small.ec, std::errc::value_too_large);
+        ASSERT_EQ(too_small.ptr, first + 20);
+    }
+
+    // Full width values in bases whose digit chunks do not divide the width, so the top chunk is only partly used.
+    TEST(bigint23, to_chars_full_width_test) {
+        using uint64 = bigint::bigint<bigint::BitWidth{64}, bigint::Signedness::Unsigned>;
+        using uint128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Unsigned>;
+        using int128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Signed>;
+        using uint520 = bigint::bigint<bigint::BitWidth{520}, bigint::Signedness::Unsigned>;
+        auto buffer = std::array<char, 400>{};
+        auto const to_string = [&buffer](std::to_chars_result const result) {
+            EXPECT_EQ(result.ec, std::errc{});
+            return std::string_view{buffer.data(), result.ptr};
+        };
+        auto const first = buffer.data();
+        auto const last = buffer.data() + buffer.size();
+        ASSERT_EQ(to_string(to_chars(first, last, ~uint64{}, 3)), "11112220022122120101211020120210210211220");
+        ASSERT_EQ(to_string(to_chars(first, last, ~uint64{}, 7)), "45012021522523134134601");
+        ASSERT_EQ(to_string(to_chars(first, last, ~uint64{}, 36)), "3w5e11264sgsf");
+        ASSERT_EQ(to_string(to_chars(first, last, ~uint128{}, 3)),
+                  "202201102121002021012000211012011021221022212021111001022110211020010021100121010");
+        ASSERT_EQ(to_string(to_chars(first, last, ~uint128{}, 5)),
+                  "11031110441201303134210404233413032443021130230130231310");
+        ASSERT_EQ(to_string(to_chars(first, last, ~uint128{}, 7)), "3115512162124626343001006330151620356026315303");
+        ASSERT_EQ(to_string(to_chars(first, last, ~uint128{}, 36)), "f5lxx1zz5pnorynqglhzmsp33");
+        ASSERT_EQ(to_string(to_chars(first, last, int128{1} << 127, 3)),
+                  "-101100201022001010121000102002120122110122221010202000122201220121120010200022002");
+        ASSERT_EQ(to_string(to_chars(first, last, int128{1} << 127, 7)), "-1406241064412313155000336513424310163013142502");
+        ASSERT_EQ(to_string(to_chars(first, last, int128{1} << 127, 36)), "-7ksyyizzkutudzbv8aqztecjk");
+
+        for (auto const &[base, digits]: {std::pair{3, 329uz}, std::pair{7, 186uz}, std::pair{36, 101uz}}) {
+            auto const text = to_string(to_chars(first, last, ~uint520{}, base));
+            ASSERT_EQ(text.size(), digits) << base;
+            auto parsed = uint520{};
+            ASSERT_EQ(from_chars(text.data(), text.data() + text.size(), parsed, base).ec, std::errc{});
+            ASSERT_EQ(parsed, ~uint520{}) << base;
+        }
+    }
+
+    TEST(bigint23, from_chars_test) {
+        using int128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Signed>;
+        using uint128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Unsigned>;
+        auto const parse = [](std::string_view const text, auto &value, int const base = 10) {
+            return from_chars(text.data(), text.data() + text.size(), value, base);
+        };
+
+        auto a = int128{};
+        ASSERT_EQ(parse("-482730796026674449308 rest", a).ec, std::errc{});
+        ASSERT_EQ(a, int128{"-482730796026674449308"});
+        ASSERT_EQ(parse("-80000000000000000000000000000000", a, 16).ec, std::errc{});
+        ASSERT_EQ(a, int128{1} << 127);
+
+        auto const out_of_range = std::string_view{"80000000000000000000000000000000"};
+        auto const result = parse(out_of_range, a, 16);
+        ASSERT_EQ(result.ec, std::errc::result_out_of_range);
+        ASSERT_EQ(result.ptr, out_of_range.data() + out_of_range.size());
+        ASSERT_EQ(a, int128{1} << 127);
+
+        auto b = uint128{7};
+        ASSERT_EQ(parse("ffffffffffffffffffffffffffffffff", b, 16).ec, std::errc{});
+        ASSERT_EQ(b, ~uint128{});
+        ASSERT_EQ(parse("100000000000000000000000000000000", b, 16).ec, std::errc::result_out_of_range);
+        ASSERT_EQ(parse("-1", b).ec, std::errc::invalid_argument);
+        auto const prefixed = std::string_view{"0x10"};
+        ASSERT_EQ(parse(prefixed, b).ptr, prefixed.data() + 1);
+        ASSERT_EQ(b, 0);
+    }
+
     TEST(bigint23, hex_unsigned_os_test) {
         bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Unsigned> const a(0x1A2B3C4D);
         std::ostringstream oss;
@@ -42,6 +146,24 @@ namespace {
         ASSERT_EQ(oss.str(), "361100");
     }
 
+    TEST(bigint23, hex_showbase_os_test) {
+        bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Unsigned> const a("0x1a2b3c4d5e6f708192a3b4c5d6e7f8");
+        std::ostringstream oss;
+        oss << std::hex << std::showbase << std::uppercase << a;
+        ASSERT_EQ(oss.str(), "0X1A2B3C4D5E6F708192A3B4C5D6E7F8");
+        oss.str("");
+        oss << bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Unsigned>{};
+        ASSERT_EQ(oss.str(), "00");
+    }
+
+    TEST(bigint23, octal_showbase_os_test) {
+        bigint::bigint<bigint::BitWidth{72}, bigint::Signedness::Signed> const a(-1);
+        bigint::bigint<bigint::BitWidth{72}, bigint::Signedness::Signed> const b(0);
+        std::ostringstream oss;
+        oss << std::oct << std::showbase << a << ' ' << b;
+        ASSERT_EQ(oss.str(), "0777777777777777777777777 0");
+    }
+
     TEST(bigint23, decimal_zero_os_test) {
         bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Unsigned> const a(0);
         std::ostringstream oss;
@@ -49,6 +171,50 @@ namespace {
         ASSERT_EQ(oss.str(), "0");
     }
 
+    // The largest values fill every digit of the last chunk, which the output buffer has to hold in full.
+    TEST(bigint23, decimal_maximum_os_test) {
+        using u24 = bigint::bigint<bigint::BitWidth{24}, bigint::Signedness::Unsigned>;
+        using u64 = bigint::bigint<bigint::BitWidth{64}, bigint::Signedness::Unsigned>;
+        using u128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Unsigned>;
+        using i128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Signed>;
+        using u192 = bigint::bigint<bigint::BitWidth{192}, bigint::Signedness::Unsigned>;
+        using u2048 = bigint::bigint<bigint::BitWidth{2048}, bigint::Signedness::Unsigned>;
+        std::ostringstream oss;
+        oss << ~u24{} << ' ' << ~u64{} << ' ' << ~u128{} << ' ' << i128{~(~u128{} >> 1)};
+        ASSERT_EQ(oss.str(), "16777215 18446744073709551615 340282366920938463463374607431768211455 "
+                             "-170141183460469231731687303715884105728");
+        oss.str("");
+        oss << ~u192{};
+        ASSERT_EQ(oss.str(), "6277101735386680763835789423207666416102355444464034512895");
+
+        oss.str("");
+        oss << ~u2048{};
+        ASSERT_EQ(oss.str().size(), 617uz);
+        u2048 parsed;
+        std::istringstream iss(oss.str());
+        iss >> parsed;
+        ASSERT_EQ(parsed, ~u2048{});
+    }
+
+    // 10^k - 1, 10^k and 10^k + 1 for every k below the digit count of the width. Between them they sit just below
+    // and just above each cached power of ten that decimal output splits by.
+    template<std::size_t width>
+    void check_powers_of_ten() {
+        using value_type = bigint::bigint<bigint::BitWidth{width}, bigint::Signedness::Unsigned>;
+        for (auto k = 1uz; k < bigint::detail::max_decimal_digits<bigint::BitWidth{width}>; ++k) {
+            for (auto const &expected: {std::string(k, '9'), "1" + std::string(k, '0'), "1" + std::string(k - 1, '0') + "1"}) {
+                std::ostringstream oss;
+                oss << value_type{expected};
+                ASSERT_EQ(oss.str(), expected);
+            }
+        }
+    }
+
+    TEST(bigint23, decimal_powers_of_ten_os_test) {
+        check_powers_of_ten<520>();
+        check_powers_of_ten<4096>();
+    }
+
     TEST(bigint23, octal_zero_os_test) {
         bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Unsigned> const a(0);
         std::ostringstream oss;
@@ -107,4 +273,18 @@ namespace {
         iss >> a;
         ASSERT_EQ(a, 0);
     }
+
+#if defined(__cpp_lib_format)
+    TEST(bigint23, std_format_test) {
+        bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Signed> const a(-255);
+        ASSERT_EQ(std::format("{}", a), "-255");
+        ASSERT_EQ(std::format("{:#x}", a), "-0xff");
+        ASSERT_EQ(std::format("{:#X}", -a), "0XFF");
+        ASSERT_EQ(std::format("{:#o}", -a), "0377");
+        ASSERT_EQ(std::format("{:b}", -a), "11111111");
+        ASSERT_EQ(std::format("{:+d}", -a), "+255");
+        ASSERT_EQ(std::format("{:*^10}", a), "***-255***");
+        ASSERT_EQ(std::format("{:#010x}", -a), "0x000000ff");
+    }
+#endif
 }
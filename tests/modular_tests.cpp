@@ -0,0 +1,350 @@
+//
+// Created by Rene Windegger on 16/10/2026.
+//
+
+#include "test_values.hpp"
+
+#include <bigint23/bigint.hpp>
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+namespace {
+    using test_values::make_value;
+    using test_values::uint_t;
+
+    // (a * b) % m with the generic division in the double width type, the reference for every modular product.
+    template<bigint::BitWidth bits>
+    auto multiply_mod(uint_t<std::to_underlying(bits)> const &a, uint_t<std::to_underlying(bits)> const &b,
+                      bigint::bigint<bits, bigint::Signedness::Unsigned> const &m) {
+        return widening_mul(a, b) % uint_t<2 * std::to_underlying(bits)>{m};
+    }
+
+    template<bigint::BitWidth bits>
+    void check_montgomery(bigint::bigint<bits, bigint::Signedness::Unsigned> const &m) {
+        constexpr auto width = std::to_underlying(bits);
+        auto const context = bigint::montgomery_context<bits>{m};
+        for (auto seed = 1u; seed < 8; ++seed) {
+            auto const a = make_value<width>(seed) % m;
+            auto const b = make_value<width>(seed + 100) % m;
+            auto const x = context.to_montgomery(a);
+            auto const y = context.to_montgomery(b);
+            ASSERT_EQ(x.value(), a);
+            ASSERT_EQ((x * y).value(), multiply_mod(a, b, m));
+            ASSERT_EQ(square(x).value(), multiply_mod(a, a, m));
+            ASSERT_EQ((x * x).value(), multiply_mod(a, a, m));
+            ASSERT_EQ(uint_t<2 * width>{(x + y).value()}, (uint_t<2 * width>{a} + b) % uint_t<2 * width>{m});
+            ASSERT_EQ((x - y).value(), a >= b ? a - b : m - (b - a));
+        }
+    }
+
+    TEST(bigint23, montgomery_test) {
+        using u256 = uint_t<256>;
+        u256 const p = "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F";
+        auto const context = bigint::montgomery_context<bigint::BitWidth{256}>{p};
+        auto const a = context.to_montgomery(u256{"0x79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798"});
+        auto const b = context.to_montgomery(u256{"0x483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8"});
+        ASSERT_EQ(context.one().value(), 1);
+        ASSERT_EQ(context.zero().value(), 0);
+        ASSERT_EQ(a * context.one(), a);
+        ASSERT_EQ((a - a).value(), 0);
+        ASSERT_EQ(a + b - b, a);
+        ASSERT_EQ((-a + a).value(), 0);
+        ASSERT_EQ(context.to_montgomery(p + 5).value(), 5);
+        // y^2 = x^3 + 7 holds for the secp256k1 generator.
+        ASSERT_EQ(square(b), square(a) * a + context.to_montgomery(7));
+
+        check_montgomery(p);
+        check_montgomery(~u256{});
+        check_montgomery(u256{0xFFFFFFFBULL});
+        check_montgomery(make_value<2048>(42) | 1);
+        check_montgomery(uint_t<96>{"0xFFFFFFFFFFFFFFFFFFFFFFC5"});
+        ASSERT_THROW(static_cast<void>(bigint::montgomery_context<bigint::BitWidth{256}>{u256{1024}}), std::invalid_argument);
+        ASSERT_THROW(static_cast<void>(bigint::montgomery_context<bigint::BitWidth{256}>{u256{1}}), std::invalid_argument);
+
+        constexpr auto c = [] {
+            auto const constant_context = bigint::montgomery_context<bigint::BitWidth{128}>{uint_t<128>{1000003}};
+            auto const x = constant_context.to_montgomery(uint_t<128>{123456});
+            return (x * x * x).value();
+        }();
+        static_assert(c == uint_t<128>{123456} * 123456 % 1000003 * 123456 % 1000003);
+    }
+
+    // base^exponent mod m with plain square-and-multiply on top of the generic operators.
+    template<bigint::BitWidth bits, bigint::BitWidth exponent_bits>
+    auto power_mod_reference(bigint::bigint<bits, bigint::Signedness::Unsigned> base,
+                             bigint::bigint<exponent_bits, bigint::Signedness::Unsigned> exponent,
+                             bigint::bigint<bits, bigint::Signedness::Unsigned> const &m) {
+        auto result = uint_t<2 * std::to_underlying(bits)>{1};
+        auto const wide_m = uint_t<2 * std::to_underlying(bits)>{m};
+        auto wide_base = uint_t<2 * std::to_underlying(bits)>{base} % wide_m;
+        for (; exponent != 0; exponent >>= 1) {
+            if ((exponent & 1) != 0) {
+                result = result * wide_base % wide_m;
+            }
+            wide_base = wide_base * wide_base % wide_m;
+        }
+        return result;
+    }
+
+    TEST(bigint23, powmod_test) {
+        using u256 = uint_t<256>;
+        using i256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Signed>;
+        u256 const p = "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F";
+        ASSERT_EQ(powmod(u256{3}, 0, p), 1);
+        ASSERT_EQ(powmod(u256{3}, 1, p), 3);
+        ASSERT_EQ(powmod(u256{3}, 5, u256{1000}), 243);
+        ASSERT_EQ(powmod(u256{7}, 100, u256{1}), 0);
+        // Fermat: a^(p - 1) = 1 for a prime p.
+        ASSERT_EQ(powmod(u256{"0x123456789ABCDEF"}, p - 1, p), 1);
+        ASSERT_EQ(powmod(i256{-2}, 3, i256{7}), 6);
+        ASSERT_THROW(static_cast<void>(powmod(u256{3}, 3, u256{0})), std::overflow_error);
+        ASSERT_THROW(static_cast<void>(powmod(u256{3}, -1, p)), std::invalid_argument);
+
+        for (auto seed = 1u; seed < 6; ++seed) {
+            auto const base = make_value<256>(seed);
+            auto const exponent = make_value<256>(seed + 10) >> (seed * 40);
+            ASSERT_EQ(powmod(base, exponent, p), power_mod_reference(base, exponent, p));
+            auto const even = make_value<256>(seed + 20) & ~u256{1};
+            ASSERT_EQ(powmod(base, exponent, even), power_mod_reference(base, exponent, even));
+        }
+        auto const m = make_value<2048>(7) | 1;
+        auto const base = make_value<2048>(8);
+        auto const exponent = make_value<1024>(9);
+        ASSERT_EQ(powmod(base, exponent, m), power_mod_reference(base, exponent, m));
+
+        static_assert(powmod(uint_t<128>{4}, 13, uint_t<128>{497}) == 445);
+        static_assert(powmod(uint_t<128>{4}, 13, uint_t<128>{496}) == 4 * 4 * 4 * 4 * 4 * 4 * 4 * 4 * 4 * 4 * 4 * 4 * 4ULL % 496);
+    }
+
+    TEST(bigint23, fixed_base_table_test) {
+        using u256 = uint_t<256>;
+        u256 const p = "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F";
+        auto const context = bigint::montgomery_context<bigint::BitWidth{256}>{p};
+        auto const g = context.to_montgomery(u256{"0x79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798"});
+        auto const table = bigint::fixed_base_table{g};
+        ASSERT_EQ(table.pow(0), context.one());
+        ASSERT_EQ(table.pow(1), g);
+        ASSERT_EQ(table.pow(p - 1), context.one());
+        for (auto seed = 1u; seed < 6; ++seed) {
+            auto const exponent = make_value<256>(seed) >> (seed * 30);
+            ASSERT_EQ(table.pow(exponent), pow(g, exponent));
+        }
+        auto const short_table = bigint::fixed_base_table{g, 64};
+        ASSERT_EQ(short_table.pow(0xFFFFFFFFFFFFFFFFULL), pow(g, 0xFFFFFFFFFFFFFFFFULL));
+        ASSERT_EQ(short_table.pow(~u256{}), pow(g, ~u256{}));
+    }
+
+    template<bigint::BitWidth bits>
+    void check_barrett(bigint::bigint<bits, bigint::Signedness::Unsigned> const &d) {
+        constexpr auto width = std::to_underlying(bits);
+        auto const divisor = bigint::barrett_divisor<bits>{d};
+        ASSERT_EQ(divisor.divisor(), d);
+        auto const check = [&](uint_t<width> const &x) {
+            auto const [quotient, remainder] = divisor.divmod(x);
+            ASSERT_EQ(quotient, x / d);
+            ASSERT_EQ(remainder, x % d);
+        };
+        check(uint_t<width>{});
+        check(d);
+        check(d - 1);
+        check(d + d);
+        check(~uint_t<width>{});
+        check(~uint_t<width>{} - d);
+        for (auto seed = 1u; seed < 16; ++seed) {
+            check(make_value<width>(seed));
+            check(make_value<width>(seed) >> (seed * width / 16));
+        }
+        ASSERT_EQ(divisor.divide(make_value<width>(99)), make_value<width>(99) / d);
+        ASSERT_EQ(divisor.remainder(make_value<width>(99)), make_value<width>(99) % d);
+    }
+
+    TEST(bigint23, barrett_divisor_test) {
+        using u256 = uint_t<256>;
+        check_barrett(u256{1});
+        check_barrett(u256{1000});
+        check_barrett(u256{0xFFFFFFFFFFFFFFFFULL});
+        check_barrett(u256{"0x10000000000000000"});
+        check_barrett(u256{"0x7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFED"});
+        check_barrett(~u256{});
+        check_barrett(make_value<256>(5) >> 70);
+        check_barrett(make_value<2048>(6) >> 1000);
+        check_barrett(make_value<2048>(7) >> 10);
+        check_barrett(uint_t<96>{"0xFFFFFFFFFFFFFFFFFFFF"});
+        ASSERT_THROW(static_cast<void>(bigint::barrett_divisor<bigint::BitWidth{256}>{u256{}}), std::overflow_error);
+
+        constexpr auto p = bigint::barrett_divisor<bigint::BitWidth{256}>{
+            u256{"0x7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFED"}
+        };
+        static_assert(p.remainder(~u256{}) == u256{37});
+        static_assert(p.divide(~u256{}) == u256{2});
+    }
+
+    // Every field operation against the generic operator%= on values spread over the whole 256 bit range.
+    template<typename field>
+    void check_field() {
+        using u256 = uint_t<256>;
+        using u512 = uint_t<512>;
+        auto const p = field::modulus();
+        auto const reduce = [&p](u512 value) {
+            value %= u512{p};
+            return bigint::detail::limb_access::truncate<u256>(value);
+        };
+        auto values = std::vector{u256{}, u256{1}, p - 1, p, p + 1, ~u256{}, ~u256{} - 1};
+        for (auto seed = 1u; seed < 16; ++seed) {
+            values.push_back(make_value<256>(seed));
+        }
+        for (auto const &a: values) {
+            auto const x = field{a};
+            ASSERT_EQ(x.value(), reduce(u512{a}));
+            ASSERT_EQ(square(x).value(), reduce(widening_mul(a, a)));
+            ASSERT_EQ((-x).value(), reduce(u512{p} - reduce(u512{a})));
+            for (auto const &b: values) {
+                auto const y = field{b};
+                ASSERT_EQ((x * y).value(), reduce(widening_mul(a, b)));
+                ASSERT_EQ((x + y).value(), reduce(u512{a} + b));
+                ASSERT_EQ((x - y).value(), reduce(u512{a} + p + p - reduce(u512{b})));
+            }
+            if (x.value() != 0) {
+                ASSERT_EQ((x * invert(x)).value(), 1);
+            }
+        }
+        // Long chains keep every intermediate below 2^256.
+        auto x = field{~u256{}};
+        auto product = field{u256{1}};
+        auto expected_x = reduce(u512{~u256{}});
+        auto expected = u256{1};
+        for (auto i = 0; i < 64; ++i) {
+            product *= x;
+            product += product;
+            product -= x;
+            x = square(x) - field{u256{1}};
+            expected = reduce(u512{reduce(widening_mul(expected, expected_x))} * 2 + u512{p} - expected_x);
+            expected_x = reduce(widening_mul(expected_x, expected_x) + u512{p} - 1);
+            ASSERT_EQ(product.value(), expected);
+            ASSERT_EQ(x.value(), expected_x);
+        }
+        ASSERT_THROW(static_cast<void>(invert(field{p})), std::invalid_argument);
+    }
+
+    TEST(bigint23, field_element_test) {
+        check_field<bigint::curve25519_field>();
+        check_field<bigint::secp256k1_field>();
+        check_field<bigint::p256_field>();
+
+        // y^2 = x^3 + 7 holds for the secp256k1 generator, y^2 = x^3 - 3x + b for the P-256 one.
+        using u256 = uint_t<256>;
+        auto const gx = bigint::secp256k1_field{u256{"0x79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798"}};
+        auto const gy = bigint::secp256k1_field{u256{"0x483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8"}};
+        ASSERT_EQ(square(gy), square(gx) * gx + bigint::secp256k1_field{u256{7}});
+        auto const hx = bigint::p256_field{u256{"0x6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296"}};
+        auto const hy = bigint::p256_field{u256{"0x4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5"}};
+        auto const b = bigint::p256_field{u256{"0x5AC635D8AA3A93E7B3EBBD55769886BC651D06B0CC53B0F63BCE3C3E27D2604B"}};
+        ASSERT_EQ(square(hy), square(hx) * hx - hx - hx - hx + b);
+
+        constexpr auto inverse = invert(bigint::curve25519_field{u256{2}}).value();
+        static_assert(inverse == u256{"0x3FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7"});
+    }
+
+    // Euclid's algorithm with operator%, the reference for gcd.
+    template<bigint::BitWidth bits, bigint::Signedness signedness>
+    auto euclid(bigint::bigint<bits, signedness> a, bigint::bigint<bits, signedness> b) {
+        a = abs(a);
+        b = abs(b);
+        while (b != 0) {
+            a = std::exchange(b, a % b);
+        }
+        return a;
+    }
+
+    template<std::size_t width, bigint::Signedness signedness>
+    void check_gcd() {
+        using value_type = bigint::bigint<bigint::BitWidth{width}, signedness>;
+        using wide_type = bigint::bigint<bigint::BitWidth{2 * width}, bigint::Signedness::Signed>;
+        auto values = std::vector<value_type>{value_type{}, value_type{1}, value_type{6}, value_type{35}};
+        for (auto seed = 1u; seed < 10; ++seed) {
+            auto const value = value_type{make_value<width>(seed) >> (seed * width / 10)};
+            values.push_back(value);
+            values.push_back(value * 12);
+            if constexpr (signedness == bigint::Signedness::Signed) {
+                values.push_back(-value);
+            } else {
+                values.push_back(value | (uint_t<width>{1} << (width - 1)));
+            }
+        }
+        for (auto const &a: values) {
+            for (auto const &b: values) {
+                auto const g = gcd(a, b);
+                ASSERT_EQ(g, euclid(a, b));
+                if (g != 0) {
+                    ASSERT_EQ(lcm(a, b), abs(a) / g * abs(b));
+                }
+                auto const [h, x, y] = extended_gcd(a, b);
+                ASSERT_EQ(h, g);
+                ASSERT_EQ(widening_mul(a, x) + widening_mul(b, y), wide_type{g});
+                if (a != 0 and b != 0) {
+                    ASSERT_LE(abs(x), abs(b) / g);
+                    ASSERT_LE(abs(y), abs(a) / g);
+                }
+            }
+        }
+    }
+
+    template<bigint::BitWidth bits>
+    void check_mod_inverse(bigint::bigint<bits, bigint::Signedness::Unsigned> const &m) {
+        constexpr auto width = std::to_underlying(bits);
+        for (auto seed = 1u; seed < 10; ++seed) {
+            auto const a = make_value<width>(seed) >> seed;
+            if (euclid(a, m) != 1) {
+                ASSERT_THROW(static_cast<void>(mod_inverse(a, m)), std::invalid_argument);
+                if ((m & 1) != 0) {
+                    ASSERT_THROW(static_cast<void>(bigint::ct::mod_inverse(a, m)), std::invalid_argument);
+                }
+                continue;
+            }
+            auto const inverse = mod_inverse(a, m);
+            ASSERT_LT(inverse, m);
+            ASSERT_EQ(multiply_mod(a % m, inverse, m), m == 1 ? 0 : 1);
+            if ((m & 1) != 0) {
+                ASSERT_EQ(bigint::ct::mod_inverse(a, m), inverse);
+            }
+        }
+    }
+
+    TEST(bigint23, gcd_test) {
+        check_gcd<64, bigint::Signedness::Unsigned>();
+        check_gcd<96, bigint::Signedness::Signed>();
+        check_gcd<256, bigint::Signedness::Unsigned>();
+        check_gcd<256, bigint::Signedness::Signed>();
+        check_gcd<1024, bigint::Signedness::Unsigned>();
+
+        using i128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Signed>;
+        constexpr auto result = extended_gcd(i128{240}, i128{-46});
+        static_assert(result.gcd == 2 and result.x == -9 and result.y == -47);
+        static_assert(gcd(i128{-48}, i128{18}) == 6);
+        static_assert(lcm(i128{4}, i128{-6}) == 12);
+    }
+
+    TEST(bigint23, mod_inverse_test) {
+        using u256 = uint_t<256>;
+        check_mod_inverse(u256{"0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F"});
+        check_mod_inverse(u256{"0xFFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632551"});
+        check_mod_inverse(~u256{});
+        check_mod_inverse(u256{1000000});
+        check_mod_inverse(u256{97});
+        check_mod_inverse(u256{1});
+        check_mod_inverse(make_value<1024>(11) | 1);
+        check_mod_inverse(make_value<1024>(12) << 1);
+        check_mod_inverse(uint_t<96>{"0xFFFFFFFFFFFFFFFFFFFFFFC5"});
+
+        using i128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Signed>;
+        ASSERT_EQ(mod_inverse(i128{-3}, i128{7}), 2);
+        ASSERT_THROW(static_cast<void>(mod_inverse(i128{3}, i128{0})), std::overflow_error);
+        ASSERT_THROW(static_cast<void>(mod_inverse(i128{3}, i128{-7})), std::invalid_argument);
+        ASSERT_THROW(static_cast<void>(bigint::ct::mod_inverse(u256{3}, u256{8})), std::invalid_argument);
+
+        static_assert(mod_inverse(i128{3}, i128{1000003}) == 666669);
+        static_assert(bigint::ct::mod_inverse(u256{3}, u256{1000003}) == 666669);
+    }
+}
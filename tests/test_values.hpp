@@ -0,0 +1,35 @@
+//
+// Created by Rene Windegger on 17/10/2026.
+//
+
+#pragma once
+
+#include <bigint23/bigint.hpp>
+
+#include <climits>
+#include <cstdint>
+#include <ranges>
+#include <type_traits>
+
+namespace test_values {
+    template<std::size_t width>
+    using uint_t = bigint::bigint<bigint::BitWidth{width}, bigint::Signedness::Unsigned>;
+
+    // One step of the 64 bit linear congruential generator (Knuth's MMIX constants) the tests draw values from.
+    constexpr std::uint64_t next_random(std::uint64_t &seed) noexcept {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        return seed;
+    }
+
+    // A full width value with one generator step per limb, most significant limb first. Narrower limbs take the
+    // upper bits of each step.
+    template<std::size_t width>
+    constexpr uint_t<width> make_value(std::uint64_t seed) noexcept {
+        auto result = uint_t<width>{};
+        for (auto &limb: std::views::reverse(bigint::detail::limb_access::limbs(result))) {
+            using limb_type = std::remove_reference_t<decltype(limb)>;
+            limb = static_cast<limb_type>(next_random(seed) >> (64 - sizeof(limb_type) * CHAR_BIT));
+        }
+        return result;
+    }
+}